@@ -0,0 +1,48 @@
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+/// <summary>
+/// Prznak, i vlkno pota alokcie
+/// </summary>
+static thread_local bool counting = false;
+/// <summary>
+/// Poet alokci vlkna od zapnutia potania
+/// </summary>
+static thread_local long long allocation_count = 0;
+
+void* operator new(size_t size)
+{
+	if (counting)
+	{
+		allocation_count++;
+	}
+	void* block = malloc(size ? size : 1);
+	if (!block)
+	{
+		throw std::bad_alloc();
+	}
+	return block;
+}
+
+void operator delete(void* block) noexcept
+{
+	free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+	free(block);
+}
+
+void AllocationCounter::start()
+{
+	allocation_count = 0;
+	counting = true;
+}
+
+long long AllocationCounter::stop()
+{
+	counting = false;
+	return allocation_count;
+}
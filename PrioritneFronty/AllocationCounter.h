@@ -0,0 +1,19 @@
+#pragma once
+
+/// <summary>
+/// Potadlo alokci cez globlny opertor new, pota len alokcie vlkna, ktor ho zapne
+/// Opertory new a delete s nahraden vo vlastnom prekladovom module, aby sa nevkladali do volajcich
+/// </summary>
+class AllocationCounter
+{
+public:
+	/// <summary>
+	/// Zapne potanie alokci volajceho vlkna
+	/// </summary>
+	static void start();
+	/// <summary>
+	/// Vypne potanie alokci volajceho vlkna
+	/// </summary>
+	/// <returns>Poet alokci od zapnutia</returns>
+	static long long stop();
+};
@@ -1,6 +1,9 @@
 #pragma once
 #include "PriorityQueue.h"
+#include "Prefetch.h"
+#include <algorithm>
 #include <vector>
+#include <climits>
 
 /// <summary>
 /// Binrna halda implementovan implicitnm zoznamom
@@ -16,23 +19,9 @@ private:
 	/// </summary>
 	std::vector<ArrayItem<Priority, Data>*>* list_;
 	/// <summary>
-	/// Vrti index avho potomka prvku na indexe index
-	/// </summary>
-	/// <param name="index">Index prvku</param>
-	/// <returns>Index avho potomka</returns>
-	int left_son(const int index);
-	/// <summary>
-	/// Vrti index pravho potomka prvku na indexe index
-	/// </summary>
-	/// <param name="index">Index prvku</param>
-	/// <returns>Index pravho potomka</returns>
-	int righ_son(const int index);
-	/// <summary>
-	/// Vrti index piameho predka prvku na indexe index
+	/// True, ak potomkovia prvku na indexe i leia na indexoch 2i + 1 a 2i + 2
 	/// </summary>
-	/// <param name="index">Index prvku</param>
-	/// <returns>Index priamho predka</returns>
-	int parent(const int index);
+	bool implicit_layout_;
 	/// <summary>
 	/// Vrti index piameho predka prvku na indexe index
 	/// </summary>
@@ -40,6 +29,11 @@ private:
 	/// <returns></returns>
 	int greater_son(const int index);
 	/// <summary>
+	/// Prednata prvky vnukov prvku na indexe index, aby boli pripraven v alom kroku heapify_down, len pri implicitnom rozloen
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	void prefetch_grandsons(const int index);
+	/// <summary>
 	/// Vymiea prvok na indexe index s priamym predkom, dokia nie je splnen haldov usporiadanie
 	/// </summary>
 	/// <param name="index">Index prvku, ktor sa vymiea</param>
@@ -55,7 +49,41 @@ private:
 	/// <param name="item_1"></param>
 	/// <param name="item_2"></param>
 	static void swap(ArrayItem<Priority, Data>*& item_1, ArrayItem<Priority, Data>*& item_2);
+	/// <summary>
+	/// Obnov haldov usporiadanie celho zoznamu zdola nahor
+	/// </summary>
+	void build_heap();
+	/// <summary>
+	/// Vrti, i je lacnejie po zmene count prvkov obnovi usporiadanie celho zoznamu, ako opravi kad prvok zvl᚝
+	/// </summary>
+	/// <param name="count">Poet zmenench prvkov</param>
+	/// <param name="size">Poet prvkov v zozname po zmene</param>
+	/// <returns>True, ak je count * log(size) vie ako size</returns>
+	static bool rebuild_is_cheaper(const size_t count, const size_t size);
 protected:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="implicit_layout">False, ak potomkovia prvku na indexe i neleia na indexoch 2i + 1 a 2i + 2</param>
+	BinaryHeap(const bool implicit_layout);
+	/// <summary>
+	/// Vrti index avho potomka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index avho potomka</returns>
+	virtual int left_son(const int index);
+	/// <summary>
+	/// Vrti index pravho potomka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index pravho potomka</returns>
+	virtual int righ_son(const int index);
+	/// <summary>
+	/// Vrti index piameho predka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index priamho predka</returns>
+	virtual int parent(const int index);
 	/// <summary>
 	/// Vymiea prvok node s jeho priamm predkom, dokia nie je splnen haldov usporiadanie
 	/// </summary>
@@ -104,22 +132,141 @@ public:
 	/// <returns>Hodnota dt</returns>
 	Data& find_min() override;
 	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
 	/// Pripoj k prioritnmu frontu prvky z other_heap
 	/// </summary>
 	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
 	void merge(PriorityQueue<Priority, Data>* other_heap) override;
 	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps, zoznamy spoj a usporiadanie obnov naraz
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps) override;
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho, na jeho miesto presunie posledn prvok zoznamu
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Vlo do prioritnho frontu dvku prvkov, pri vekej dvke prvky pripoj na koniec zoznamu a usporiadanie obnov naraz
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	void push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
+	/// Zmen priority dvky prvkov, pri vekej dvke zmen vetky priority a usporiadanie obnov naraz
+	/// </summary>
+	/// <param name="operations">Opercie zmeny priority s nastavenmi prvkami</param>
+	void change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu najviac count prvkov s najvou prioritou, pri vekom count ich njde
+	/// prehadvanm haldy pomocnou haldou kandidtov, bez vyberania odstrni naraz a usporiadanie obnov naraz
+	/// </summary>
+	/// <param name="count">Najv poet vybranch prvkov</param>
+	/// <param name="out">Identifiktory a dta vybranch prvkov</param>
+	/// <returns>Poet vybranch prvkov</returns>
+	size_t pop_n(const size_t count, std::vector<std::pair<int, Data>>& out) override;
+};
+
+/// <summary>
+/// Binrna halda implementovan implicitnm zoznamom, v ktorom s podstromy uloen v blokoch vekosti strnky alebo riadku vyrovnvacej pamte
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class BinaryHeapBlocked : public BinaryHeap<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Poet pozci v bloku, mocnina dvoch
+	/// </summary>
+	long long block_size_;
+	/// <summary>
+	/// Poet prvkov v bloku, blok obsahuje pln binrny strom
+	/// </summary>
+	long long block_item_count_;
+	/// <summary>
+	/// Ohrani index potomka, ktor nemono reprezentova, tak aby leal mimo zoznamu
+	/// </summary>
+	/// <param name="index">Index potomka</param>
+	/// <returns>Index potomka</returns>
+	static int limit(long long index);
+protected:
+	/// <summary>
+	/// Vrti index avho potomka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index avho potomka</returns>
+	int left_son(const int index) override;
+	/// <summary>
+	/// Vrti index pravho potomka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index pravho potomka</returns>
+	int righ_son(const int index) override;
+	/// <summary>
+	/// Vrti index piameho predka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index priamho predka</returns>
+	int parent(const int index) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="block_height">Vka stromu v bloku, 9 zodpoved strnke 4 KB, 3 riadku vyrovnvacej pamte 64 B</param>
+	BinaryHeapBlocked(const int block_height = 9);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~BinaryHeapBlocked();
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override { this->BinaryHeap<Priority, Data>::push(identifier, priority, data, data_item); };
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override { return this->BinaryHeap<Priority, Data>::pop(identifier); };
+	/// <summary>
 	/// Zmen prioritu prvku
 	/// </summary>
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->BinaryHeap<Priority, Data>::erase(node); };
 };
 
 template<typename Priority, typename Data>
 inline BinaryHeap<Priority, Data>::BinaryHeap() :
+	BinaryHeap<Priority, Data>(true)
+{
+}
+
+template<typename Priority, typename Data>
+inline BinaryHeap<Priority, Data>::BinaryHeap(const bool implicit_layout) :
 	PriorityQueue<Priority, Data>(),
-	list_(new std::vector<ArrayItem<Priority, Data>*>())
+	list_(new std::vector<ArrayItem<Priority, Data>*>()),
+	implicit_layout_(implicit_layout)
 {
 }
 
@@ -149,7 +296,7 @@ inline size_t BinaryHeap<Priority, Data>::size() const
 template<typename Priority, typename Data>
 inline void BinaryHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
 {
-	ArrayItem<Priority, Data>* new_node = new ArrayItem<Priority, Data>(identifier, priority, data, this->size());
+	ArrayItem<Priority, Data>* new_node = this->template create_item<ArrayItem<Priority, Data>>(identifier, priority, data, this->size());
 	this->list_->push_back(new_node);
 	this->heapify_up(this->size() - 1);
 	data_item = new_node;
@@ -172,10 +319,29 @@ inline Data BinaryHeap<Priority, Data>::pop(int& identifier)
 	this->heapify_down(0);
 	Data data = item->data();
 	identifier = item->identifier();
-	delete item;
+	this->destroy_item(item);
 	return data;
 }
 
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	int index = ((ArrayItem<Priority, Data>*)node)->index();
+	int last = (int)this->size() - 1;
+	if (index != last)
+	{
+		swap((*this->list_)[index], (*this->list_)[last]);
+	}
+	this->list_->pop_back();
+	if (index != last)
+	{
+		ArrayItem<Priority, Data>* moved = (*this->list_)[index];
+		this->heapify_up(index);
+		this->heapify_down(moved->index());
+	}
+	this->destroy_item(node);
+}
+
 template<typename Priority, typename Data>
 inline Data& BinaryHeap<Priority, Data>::find_min()
 {
@@ -186,19 +352,149 @@ inline Data& BinaryHeap<Priority, Data>::find_min()
 	return (*this->list_)[0]->data();
 }
 
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* BinaryHeap<Priority, Data>::find_min_item()
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("BinaryHeap<Priority, Data>::find_min_item(): Zoznam je prazdny");
+	}
+	return (*this->list_)[0];
+}
+
 template<typename Priority, typename Data>
 inline void BinaryHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
 {
 	BinaryHeap<Priority, Data>* heap = (BinaryHeap<Priority, Data>*)other_heap;
 	this->list_->insert(this->list_->end(), heap->list_->begin(), heap->list_->end());
-	if (this->size() > 1)
+	heap->list_->clear();
+	for (int i = 0; i < (int)this->size(); i++)
+	{
+		(*this->list_)[i]->index() = i;
+	}
+	this->build_heap();
+	delete heap;
+}
+
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	size_t old_size = this->size(), new_size = old_size;
+	for (PriorityQueue<Priority, Data>* heap : heaps)
+	{
+		new_size += heap->size();
+	}
+	this->list_->reserve(new_size);
+	for (PriorityQueue<Priority, Data>* other_heap : heaps)
+	{
+		BinaryHeap<Priority, Data>* heap = (BinaryHeap<Priority, Data>*)other_heap;
+		this->list_->insert(this->list_->end(), heap->list_->begin(), heap->list_->end());
+		heap->list_->clear();
+		delete heap;
+	}
+	heaps.clear();
+	for (int i = (int)old_size; i < (int)this->size(); i++)
+	{
+		(*this->list_)[i]->index() = i;
+	}
+	this->build_heap();
+}
+
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	if (!rebuild_is_cheaper(operations.size(), this->size() + operations.size()))
+	{
+		this->PriorityQueue<Priority, Data>::push_batch(operations);
+		return;
+	}
+	this->list_->reserve(this->size() + operations.size());
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		ArrayItem<Priority, Data>* new_node = this->template create_item<ArrayItem<Priority, Data>>(operation.identifier(), operation.priority(), operation.data(), this->size());
+		this->list_->push_back(new_node);
+		operation.node() = new_node;
+	}
+	this->build_heap();
+}
+
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	if (!rebuild_is_cheaper(operations.size(), this->size()))
+	{
+		this->PriorityQueue<Priority, Data>::change_priority_batch(operations);
+		return;
+	}
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		operation.node()->priority() = operation.priority();
+	}
+	this->build_heap();
+}
+
+template<typename Priority, typename Data>
+inline size_t BinaryHeap<Priority, Data>::pop_n(const size_t count, std::vector<std::pair<int, Data>>& out)
+{
+	size_t popped = std::min(count, this->size());
+	if (!rebuild_is_cheaper(popped, this->size() - popped))
+	{
+		return this->PriorityQueue<Priority, Data>::pop_n(count, out);
+	}
+	std::vector<ArrayItem<Priority, Data>*>& list = *this->list_;
+	std::vector<int> candidates;
+	auto is_worse = [&list](const int index_1, const int index_2)
+	{
+		return *list[index_2] < *list[index_1];
+	};
+	if (popped > 0)
+	{
+		candidates.push_back(0);
+	}
+	for (size_t i = 0; i < popped; i++)
 	{
-		int greater_son;
-		for (int i = (this->size() - 1) / 2; i <= 0; i--)
+		std::pop_heap(candidates.begin(), candidates.end(), is_worse);
+		int index = candidates.back();
+		candidates.pop_back();
+		for (int son : { this->left_son(index), this->righ_son(index) })
 		{
-			this->heapify_down(i);
+			if (son < (int)list.size())
+			{
+				candidates.push_back(son);
+				std::push_heap(candidates.begin(), candidates.end(), is_worse);
+			}
 		}
+		out.emplace_back(list[index]->identifier(), list[index]->data());
+		this->destroy_item(list[index]);
+		list[index] = nullptr;
+	}
+	list.erase(std::remove(list.begin(), list.end(), nullptr), list.end());
+	for (int i = 0; i < (int)list.size(); i++)
+	{
+		list[i]->index() = i;
+	}
+	this->build_heap();
+	return popped;
+}
+
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::build_heap()
+{
+	for (int i = (int)this->size() - 1; i >= 0; i--)
+	{
+		this->heapify_down(i);
+	}
+}
+
+template<typename Priority, typename Data>
+inline bool BinaryHeap<Priority, Data>::rebuild_is_cheaper(const size_t count, const size_t size)
+{
+	size_t log_size = 0;
+	for (size_t i = size; i > 1; i >>= 1)
+	{
+		log_size++;
 	}
+	return count * log_size > size;
 }
 
 template<typename Priority, typename Data>
@@ -222,6 +518,7 @@ inline int BinaryHeap<Priority, Data>::parent(const int index)
 template<typename Priority, typename Data>
 inline int BinaryHeap<Priority, Data>::greater_son(const int index)
 {
+	this->prefetch_grandsons(index);
 	PriorityQueueItem<Priority, Data>* lChild = this->left_son(index) < this->size() ? (*this->list_)[this->left_son(index)] : nullptr;
 	PriorityQueueItem<Priority, Data>* rChild = this->righ_son(index) < this->size() ? (*this->list_)[this->righ_son(index)] : nullptr;
 	if (lChild && rChild)
@@ -231,6 +528,21 @@ inline int BinaryHeap<Priority, Data>::greater_son(const int index)
 	return this->left_son(index);
 }
 
+template<typename Priority, typename Data>
+inline void BinaryHeap<Priority, Data>::prefetch_grandsons([[maybe_unused]] const int index)
+{
+#if PRIORITY_QUEUE_PREFETCH
+	if (this->implicit_layout_)
+	{
+		int last = std::min(4 * index + 6, (int)this->size() - 1);
+		for (int grandson = 4 * index + 3; grandson <= last; grandson++)
+		{
+			Prefetch::read((*this->list_)[grandson]);
+		}
+	}
+#endif
+}
+
 template<typename Priority, typename Data>
 inline void BinaryHeap<Priority, Data>::heapify_up(const int index)
 {
@@ -269,3 +581,58 @@ inline void BinaryHeap<Priority, Data>::priority_was_decreased(PriorityQueueItem
 	int index = ((ArrayItem<Priority, Data>*)node)->index();
 	this->heapify_down(index);
 }
+
+template<typename Priority, typename Data>
+inline BinaryHeapBlocked<Priority, Data>::BinaryHeapBlocked(const int block_height) :
+	BinaryHeap<Priority, Data>(false), block_size_(1LL << std::max(block_height, 2)), block_item_count_((1LL << std::max(block_height, 2)) - 1)
+{
+}
+
+template<typename Priority, typename Data>
+inline BinaryHeapBlocked<Priority, Data>::~BinaryHeapBlocked()
+{
+}
+
+template<typename Priority, typename Data>
+inline int BinaryHeapBlocked<Priority, Data>::limit(long long index)
+{
+	return index > INT_MAX ? INT_MAX : (int)index;
+}
+
+template<typename Priority, typename Data>
+inline int BinaryHeapBlocked<Priority, Data>::left_son(const int index)
+{
+	long long block = index / this->block_item_count_, position = index % this->block_item_count_ + 1;
+	if (2 * position < this->block_size_)
+	{
+		return limit(block * this->block_item_count_ + 2 * position - 1);
+	}
+	return limit((block * this->block_size_ + 1 + 2 * (position - this->block_size_ / 2)) * this->block_item_count_);
+}
+
+template<typename Priority, typename Data>
+inline int BinaryHeapBlocked<Priority, Data>::righ_son(const int index)
+{
+	long long block = index / this->block_item_count_, position = index % this->block_item_count_ + 1;
+	if (2 * position + 1 < this->block_size_)
+	{
+		return limit(block * this->block_item_count_ + 2 * position);
+	}
+	return limit((block * this->block_size_ + 2 + 2 * (position - this->block_size_ / 2)) * this->block_item_count_);
+}
+
+template<typename Priority, typename Data>
+inline int BinaryHeapBlocked<Priority, Data>::parent(const int index)
+{
+	long long block = index / this->block_item_count_, position = index % this->block_item_count_ + 1;
+	if (position > 1)
+	{
+		return (int)(block * this->block_item_count_ + position / 2 - 1);
+	}
+	if (block == 0)
+	{
+		return 0;
+	}
+	long long parent_block = (block - 1) / this->block_size_, parent_position = this->block_size_ / 2 + (block - 1) % this->block_size_ / 2;
+	return (int)(parent_block * this->block_item_count_ + parent_position - 1);
+}
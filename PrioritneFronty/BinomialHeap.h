@@ -17,13 +17,16 @@ protected:
 	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
 	/// <summary>
 	/// Vymiea prvok node s tm z priamch potomkov, ktor ma najviu prioritu, dokia nie je splnen haldov usporiadanie
+	/// Ak je prvok koreom root_, hadanie minima odlo do najbliieho zluovania
 	/// </summary>
 	/// <param name="node">Vymiean prvok</param>
 	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
 	/// <summary>
-	/// Uprav smernky v pravej chrbtici atribtu root_, aby smerovali ku koreom stromov
+	/// Nahrad v zozname koreov kore old_root prvkom new_root, ktor s nm bol vymenen a prevzal jeho nasledovnka v zozname
 	/// </summary>
-	void repair_broken_root_list();
+	/// <param name="old_root">Pvodn kore stromu</param>
+	/// <param name="new_root">Nov kore stromu</param>
+	void replace_root(BinaryTreeItem<Priority, Data>* old_root, BinaryTreeItem<Priority, Data>* new_root);
 	/// <summary>
 	/// Abstraktn kontruktor
 	/// </summary>
@@ -42,10 +45,25 @@ public:
 	/// <param name="data_item">Vytvoren prvok</param>
 	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
 	/// <summary>
+	/// Vlo dvku prvkov, kad vlkno zli svoju as do binomickho lesa a lesy sa so zoznamom koreov zlia naraz
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	void push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
 	/// Pripoj k prioritnmu frontu prvky z other_heap
 	/// </summary>
 	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
 	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps, ich zoznamy koreov zreaz a zli naraz
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps) override;
+	/// <summary>
+	/// Vymiea prvok s priamym predkom a po kore stromu, kore odstrni zo zoznamu koreov a prvok zru
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
 };
 
 
@@ -92,6 +110,11 @@ public:
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->BinomialHeap<Priority, Data>::erase(node); };
 };
 
 /// <summary>
@@ -137,6 +160,11 @@ public:
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->BinomialHeap<Priority, Data>::erase(node); };
 };
 
 template<typename Priority, typename Data>
@@ -153,35 +181,129 @@ inline BinomialHeap<Priority, Data>::~BinomialHeap()
 template<typename Priority, typename Data>
 inline void BinomialHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
 {
-	DegreeBinaryTreeItem<Priority, Data>* new_item = new DegreeBinaryTreeItem<Priority, Data>(identifier, priority, data);
+	DegreeBinaryTreeItem<Priority, Data>* new_item = this->template create_item<DegreeBinaryTreeItem<Priority, Data>>(identifier, priority, data);
 	this->size_++;
 	this->consolidate_root(new_item);
 	data_item = new_item;
 }
 
+template<typename Priority, typename Data>
+inline void BinomialHeap<Priority, Data>::push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	size_t thread_count = PriorityQueue<Priority, Data>::batch_thread_count(operations.size());
+	if (thread_count == 1)
+	{
+		this->PriorityQueue<Priority, Data>::push_batch(operations);
+		return;
+	}
+
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		operation.node() = this->template create_item<DegreeBinaryTreeItem<Priority, Data>>(operation.identifier(), operation.priority(), operation.data());
+	}
+	std::vector<BinaryTreeItem<Priority, Data>*> forests(thread_count, nullptr);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		threads.emplace_back([&operations, &forests, thread_count, t]()
+		{
+			std::vector<BinaryTreeItem<Priority, Data>*> node_list, merged_list;
+			for (size_t i = operations.size() * t / thread_count; i < operations.size() * (t + 1) / thread_count; i++)
+			{
+				LazyBinomialHeap<Priority, Data>::link_tree((BinaryTreeItem<Priority, Data>*)operations[i].node(), node_list, merged_list, ConsolidationStrategy::MULTI_PASS);
+			}
+			BinaryTreeItem<Priority, Data>* forest = nullptr;
+			for (BinaryTreeItem<Priority, Data>* tree : node_list)
+			{
+				if (tree)
+				{
+					tree->right_son() = forest;
+					forest = tree;
+				}
+			}
+			forests[t] = forest;
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	BinaryTreeItem<Priority, Data>* node = nullptr;
+	for (BinaryTreeItem<Priority, Data>* forest : forests)
+	{
+		BinaryTreeItem<Priority, Data>* last_tree = forest;
+		while (last_tree->right_son())
+		{
+			last_tree = last_tree->right_son();
+		}
+		last_tree->right_son() = node;
+		node = forest;
+	}
+	this->size_ += operations.size();
+	this->consolidate_root(node);
+}
+
 template<typename Priority, typename Data>
 inline void BinomialHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
 {
 	BinomialHeap<Priority, Data>* heap = (BinomialHeap<Priority, Data>*)other_heap;
 	this->size_ += heap->size_;
-	this->consolidate_root(heap->root_);
+	if (heap->root_)
+	{
+		BinaryTreeItem<Priority, Data>* node = heap->root_->right_son();
+		heap->root_->right_son() = nullptr;
+		this->consolidate_root(node);
+	}
 	heap->root_ = nullptr;
 	delete other_heap;
 }
 
+template<typename Priority, typename Data>
+inline void BinomialHeap<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	BinaryTreeItem<Priority, Data>* node = nullptr;
+	for (PriorityQueue<Priority, Data>* other_heap : heaps)
+	{
+		BinomialHeap<Priority, Data>* heap = (BinomialHeap<Priority, Data>*)other_heap;
+		this->size_ += heap->size_;
+		if (heap->root_)
+		{
+			BinaryTreeItem<Priority, Data>* first_node = heap->root_->right_son();
+			heap->root_->right_son() = node;
+			node = first_node;
+		}
+		heap->root_ = nullptr;
+		delete other_heap;
+	}
+	heaps.clear();
+	if (node)
+	{
+		this->consolidate_root(node);
+	}
+}
+
 template<typename Priority, typename Data>
 inline void BinomialHeap<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>* node)
 {
 	DegreeBinaryTreeItem<Priority, Data>* casted_node = (DegreeBinaryTreeItem<Priority, Data>*)node;
-	BinaryTreeItem<Priority, Data>* ordered_ancestor = casted_node->ancestor();
+	BinaryTreeItem<Priority, Data>* ordered_ancestor = casted_node->ancestor(), * replaced_root = nullptr;
 	while (ordered_ancestor && *casted_node < *ordered_ancestor)
 	{
+		if (!ordered_ancestor->parent())
+		{
+			replaced_root = ordered_ancestor;
+		}
 		casted_node->swap_with_ancestor_node(ordered_ancestor);
 		ordered_ancestor = casted_node->ancestor();
 	}
-	if (!casted_node->parent() && casted_node != this->root_)
+	if (replaced_root)
+	{
+		this->replace_root(replaced_root, casted_node);
+	}
+	if (!casted_node->parent() && *casted_node < *this->root_)
 	{
-		this->repair_broken_root_list();
+		this->root_ = casted_node;
 	}
 }
 
@@ -189,50 +311,57 @@ template<typename Priority, typename Data>
 inline void BinomialHeap<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>* node)
 {
 	DegreeBinaryTreeItem<Priority, Data>* casted_node = (DegreeBinaryTreeItem<Priority, Data>*)node;
-	BinaryTreeItem<Priority, Data>* minimal_son = casted_node->highest_priority_son();
-	bool is_root_item = !casted_node->parent();
+	BinaryTreeItem<Priority, Data>* minimal_son = this->highest_priority_son(casted_node), * new_root = nullptr;
+	if (casted_node == this->root_)
+	{
+		this->root_dirty_ = true;
+	}
 	while (minimal_son && *minimal_son < *casted_node)
 	{
+		if (!casted_node->parent())
+		{
+			new_root = minimal_son;
+		}
 		minimal_son->swap_with_ancestor_node(casted_node);
-		minimal_son = casted_node->highest_priority_son();
+		minimal_son = this->highest_priority_son(casted_node);
 	}
-	if (is_root_item)
+	if (new_root)
 	{
-		this->repair_broken_root_list();
+		this->replace_root(casted_node, new_root);
 	}
 }
 
 template<typename Priority, typename Data>
-inline void BinomialHeap<Priority, Data>::repair_broken_root_list()
+inline void BinomialHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
 {
-	auto get_highest_node = [](BinaryTreeItem<Priority, Data>* node)
+	DegreeBinaryTreeItem<Priority, Data>* casted_node = (DegreeBinaryTreeItem<Priority, Data>*)node;
+	BinaryTreeItem<Priority, Data>* ordered_ancestor = casted_node->ancestor(), * replaced_root = nullptr;
+	while (ordered_ancestor)
 	{
-		if (node->parent())
-		{
-			BinaryTreeItem<Priority, Data>* node_ptr = node->parent();
-			while (node_ptr->parent())
-			{
-				node_ptr = node_ptr->parent();
-			}
-			return node_ptr;
-		}
-		return node;
-	};
-	if (this->root_)
+		replaced_root = ordered_ancestor;
+		casted_node->swap_with_ancestor_node(ordered_ancestor);
+		ordered_ancestor = casted_node->ancestor();
+	}
+	if (replaced_root)
 	{
-		this->root_ = get_highest_node(this->root_);
-		this->root_->right_son() = get_highest_node(this->root_->right_son());
-		BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son(), * root = this->root_;
-		while (node_ptr != this->root_)
-		{
-			if (*node_ptr < *root)
-			{
-				root = node_ptr;
-			}
-			node_ptr->right_son() = get_highest_node(node_ptr->right_son());
-			node_ptr = node_ptr->right_son();
-		}
-		this->root_ = root;
+		this->replace_root(replaced_root, casted_node);
+	}
+	this->remove_root(casted_node);
+	this->destroy_item(casted_node);
+}
+
+template<typename Priority, typename Data>
+inline void BinomialHeap<Priority, Data>::replace_root(BinaryTreeItem<Priority, Data>* old_root, BinaryTreeItem<Priority, Data>* new_root)
+{
+	BinaryTreeItem<Priority, Data>* node_ptr = new_root;
+	while (node_ptr->right_son() != old_root)
+	{
+		node_ptr = node_ptr->right_son();
+	}
+	node_ptr->right_son() = new_root;
+	if (this->root_ == old_root)
+	{
+		this->root_ = new_root;
 	}
 }
 
@@ -0,0 +1,798 @@
+#pragma once
+#include "PriorityQueue.h"
+#include <type_traits>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Abstraktn priehradkov front s bitovou mapou obsadench priehradok
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class BucketQueue : public PriorityQueue<Priority, Data>
+{
+	static_assert(std::is_integral<Priority>::value, "BucketQueue<Priority, Data>: Priorita musi byt celociselna");
+protected:
+	/// <summary>
+	/// Poet bitov v slove bitovej mapy
+	/// </summary>
+	static const size_t WORD_SIZE = 64;
+	/// <summary>
+	/// Prv prvky cyklickch zoznamov jednotlivch priehradok
+	/// </summary>
+	std::vector<BucketItem<Priority, Data>*>* buckets_;
+	/// <summary>
+	/// Bitov mapa neprzdnych priehradok
+	/// </summary>
+	std::vector<unsigned long long>* occupancy_;
+	/// <summary>
+	/// Bitov mapa nenulovch slov v occupancy_
+	/// </summary>
+	std::vector<unsigned long long>* summary_;
+	/// <summary>
+	/// Poet prvkov v prioritnom fronte
+	/// </summary>
+	size_t size_;
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="bucket_count">Poet priehradok</param>
+	BucketQueue(size_t bucket_count);
+	/// <summary>
+	/// Vrti index priehradky pre prioritu
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>Index priehradky</returns>
+	virtual size_t bucket_index(const Priority& priority) = 0;
+	/// <summary>
+	/// Vrti, i prioritu mono uloi do niektorej priehradky
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>True, ak je priorita z rozsahu frontu</returns>
+	virtual bool in_range(const Priority& priority) = 0;
+	/// <summary>
+	/// Vrti prvok s najvyou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvyou prioritou</returns>
+	virtual BucketItem<Priority, Data>* minimal_item() = 0;
+	/// <summary>
+	/// Zmen poet priehradok a rozdel do nich vetky prvky
+	/// </summary>
+	/// <param name="bucket_count">Nov poet priehradok</param>
+	void rebuild(size_t bucket_count);
+	/// <summary>
+	/// Pripoj prvok na koniec priehradky poda jeho priority
+	/// </summary>
+	/// <param name="node">Vkladan prvok</param>
+	void insert_item(BucketItem<Priority, Data>* node);
+	/// <summary>
+	/// Odpoj prvok z jeho priehradky
+	/// </summary>
+	/// <param name="node">Odpjan prvok</param>
+	void remove_item(BucketItem<Priority, Data>* node);
+	/// <summary>
+	/// Vrti index prvej neprzdnej priehradky s indexom aspo from
+	/// </summary>
+	/// <param name="from">Index, od ktorho sa had</param>
+	/// <returns>Index priehradky, alebo poet priehradok, ak tak neexistuje</returns>
+	size_t find_first_bucket(size_t from);
+	/// <summary>
+	/// Vrti index najniieho nastavenho bitu
+	/// </summary>
+	/// <param name="word">Nenulov slovo</param>
+	/// <returns>Index bitu</returns>
+	static size_t find_first_set(unsigned long long word);
+	/// <summary>
+	/// Presunie prvok do priehradky poda novej priority
+	/// </summary>
+	/// <param name="node">Prvok so zvenou prioritou</param>
+	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Presunie prvok do priehradky poda novej priority
+	/// </summary>
+	/// <param name="node">Prvok so znenou prioritou</param>
+	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
+public:
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~BucketQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vrti poet prvkov v prioritnom fronte
+	/// </summary>
+	/// <returns>Poet prvkov v prioritnom fronte</returns>
+	size_t size() const override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Zmen prioritu prvku, prioritu mimo rozsahu odmietne bez zmeny prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky z other_heap
+	/// </summary>
+	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
+	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+};
+
+/// <summary>
+/// Priehradkov front pre priority z ohranienho rozsahu, prvky s rovnakou prioritou sa vyberaj v porad vloenia
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class BucketQueueBounded : public BucketQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Najvyia povolen priorita
+	/// </summary>
+	Priority minimal_priority_;
+protected:
+	/// <summary>
+	/// Vrti index priehradky pre prioritu
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>Index priehradky</returns>
+	size_t bucket_index(const Priority& priority) override;
+	/// <summary>
+	/// Vrti, i priorita le medzi najvyou a najniou povolenou prioritou
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>True, ak je priorita z rozsahu frontu</returns>
+	bool in_range(const Priority& priority) override;
+	/// <summary>
+	/// Vrti prv prvok prvej neprzdnej priehradky
+	/// </summary>
+	/// <returns>Prvok s najvyou prioritou</returns>
+	BucketItem<Priority, Data>* minimal_item() override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="minimal_priority">Najvyia povolen priorita</param>
+	/// <param name="maximal_priority">Najniia povolen priorita</param>
+	BucketQueueBounded(const Priority& minimal_priority = 0, const Priority& maximal_priority = 4095);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~BucketQueueBounded();
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override { this->BucketQueue<Priority, Data>::push(identifier, priority, data, data_item); };
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override { return this->BucketQueue<Priority, Data>::pop(identifier); };
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->BucketQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->BucketQueue<Priority, Data>::erase(node); };
+};
+
+/// <summary>
+/// Kalendrov front pre asovo usporiadan udalosti s pribline rovnomernm rozloenm priort
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class BucketQueueCalendar : public BucketQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Najmen poet priehradok
+	/// </summary>
+	static const size_t MINIMAL_BUCKET_COUNT = 64;
+	/// <summary>
+	/// rka priehradky (dka da)
+	/// </summary>
+	Priority width_;
+	/// <summary>
+	/// De, od ktorho sa had prvok s najvyou prioritou, iadny prvok nepatr do skorieho da
+	/// </summary>
+	Priority current_day_;
+	/// <summary>
+	/// Prispsob poet priehradok a ich rku potu prvkov
+	/// </summary>
+	void resize();
+	/// <summary>
+	/// Posunie aktulny de, ak prvok node patr do skorieho da
+	/// </summary>
+	/// <param name="node">Vloen prvok alebo prvok so zvenou prioritou</param>
+	void move_current_day(BucketItem<Priority, Data>* node);
+protected:
+	/// <summary>
+	/// Vrti index priehradky pre prioritu
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>Index priehradky</returns>
+	size_t bucket_index(const Priority& priority) override;
+	/// <summary>
+	/// Vrti, i je priorita nezporn
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <returns>True, ak je priorita z rozsahu frontu</returns>
+	bool in_range(const Priority& priority) override;
+	/// <summary>
+	/// Prechdza dni kalendra od aktulneho da, km nenjde prvok patriaci do prehadvanho da
+	/// </summary>
+	/// <returns>Prvok s najvyou prioritou</returns>
+	BucketItem<Priority, Data>* minimal_item() override;
+	/// <summary>
+	/// Presunie prvok do priehradky poda novej priority
+	/// </summary>
+	/// <param name="node">Prvok so zvenou prioritou</param>
+	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="width">Poiaton rka priehradky</param>
+	BucketQueueCalendar(const Priority& width = 1);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~BucketQueueCalendar();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->BucketQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky z other_heap
+	/// </summary>
+	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
+	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+};
+
+template<typename Priority, typename Data>
+inline BucketQueue<Priority, Data>::BucketQueue(size_t bucket_count) :
+	PriorityQueue<Priority, Data>(),
+	buckets_(new std::vector<BucketItem<Priority, Data>*>(bucket_count)),
+	occupancy_(new std::vector<unsigned long long>((bucket_count + WORD_SIZE - 1) / WORD_SIZE)),
+	summary_(new std::vector<unsigned long long>((bucket_count + WORD_SIZE * WORD_SIZE - 1) / (WORD_SIZE * WORD_SIZE))),
+	size_(0)
+{
+}
+
+template<typename Priority, typename Data>
+inline BucketQueue<Priority, Data>::~BucketQueue()
+{
+	this->clear();
+	delete this->buckets_;
+	delete this->occupancy_;
+	delete this->summary_;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::clear()
+{
+	BucketItem<Priority, Data>* node_ptr, * node_next_ptr;
+	for (size_t bucket = this->find_first_bucket(0); bucket < this->buckets_->size(); bucket = this->find_first_bucket(bucket + 1))
+	{
+		node_ptr = (*this->buckets_)[bucket];
+		do
+		{
+			node_next_ptr = node_ptr->next();
+			delete node_ptr;
+			node_ptr = node_next_ptr;
+		} while (node_ptr != (*this->buckets_)[bucket]);
+		(*this->buckets_)[bucket] = nullptr;
+	}
+	std::fill(this->occupancy_->begin(), this->occupancy_->end(), 0);
+	std::fill(this->summary_->begin(), this->summary_->end(), 0);
+	this->size_ = 0;
+}
+
+template<typename Priority, typename Data>
+inline size_t BucketQueue<Priority, Data>::size() const
+{
+	return this->size_;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
+{
+	if (!this->in_range(priority))
+	{
+		throw new std::out_of_range("BucketQueue<Priority, Data>::push(): Priorita je mimo rozsahu");
+	}
+	BucketItem<Priority, Data>* new_node = this->template create_item<BucketItem<Priority, Data>>(identifier, priority, data);
+	this->insert_item(new_node);
+	this->size_++;
+	data_item = new_node;
+}
+
+template<typename Priority, typename Data>
+inline Data BucketQueue<Priority, Data>::pop(int& identifier)
+{
+	if (this->size_ == 0)
+	{
+		throw new std::out_of_range("BucketQueue<Priority, Data>::pop(): Zoznam je prazdny");
+	}
+	BucketItem<Priority, Data>* node = this->minimal_item();
+	this->remove_item(node);
+	this->size_--;
+	Data data = node->data();
+	identifier = node->identifier();
+	this->destroy_item(node);
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority)
+{
+	if (!this->in_range(priority))
+	{
+		throw new std::out_of_range("BucketQueue<Priority, Data>::change_priority(): Priorita je mimo rozsahu");
+	}
+	this->PriorityQueue<Priority, Data>::change_priority(node, priority);
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	this->remove_item((BucketItem<Priority, Data>*)node);
+	this->size_--;
+	this->destroy_item(node);
+}
+
+template<typename Priority, typename Data>
+inline Data& BucketQueue<Priority, Data>::find_min()
+{
+	if (this->size_ == 0)
+	{
+		throw new std::out_of_range("BucketQueue<Priority, Data>::find_min(): Zoznam je prazdny");
+	}
+	return this->minimal_item()->data();
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* BucketQueue<Priority, Data>::find_min_item()
+{
+	if (this->size_ == 0)
+	{
+		throw new std::out_of_range("BucketQueue<Priority, Data>::find_min_item(): Zoznam je prazdny");
+	}
+	return this->minimal_item();
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
+{
+	BucketQueue<Priority, Data>* heap = (BucketQueue<Priority, Data>*)other_heap;
+	BucketItem<Priority, Data>* node_ptr, * node_next_ptr;
+	for (size_t bucket = heap->find_first_bucket(0); bucket < heap->buckets_->size(); bucket = heap->find_first_bucket(bucket + 1))
+	{
+		node_ptr = (*heap->buckets_)[bucket];
+		do
+		{
+			node_next_ptr = node_ptr->next();
+			this->insert_item(node_ptr);
+			node_ptr = node_next_ptr;
+		} while (node_ptr != (*heap->buckets_)[bucket]);
+		(*heap->buckets_)[bucket] = nullptr;
+	}
+	std::fill(heap->occupancy_->begin(), heap->occupancy_->end(), 0);
+	std::fill(heap->summary_->begin(), heap->summary_->end(), 0);
+	this->size_ += heap->size_;
+	heap->size_ = 0;
+	delete heap;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::rebuild(size_t bucket_count)
+{
+	std::vector<BucketItem<Priority, Data>*> nodes;
+	BucketItem<Priority, Data>* node_ptr;
+	nodes.reserve(this->size_);
+	for (size_t bucket = this->find_first_bucket(0); bucket < this->buckets_->size(); bucket = this->find_first_bucket(bucket + 1))
+	{
+		node_ptr = (*this->buckets_)[bucket];
+		do
+		{
+			nodes.push_back(node_ptr);
+			node_ptr = node_ptr->next();
+		} while (node_ptr != (*this->buckets_)[bucket]);
+	}
+	this->buckets_->assign(bucket_count, nullptr);
+	this->occupancy_->assign((bucket_count + WORD_SIZE - 1) / WORD_SIZE, 0);
+	this->summary_->assign((bucket_count + WORD_SIZE * WORD_SIZE - 1) / (WORD_SIZE * WORD_SIZE), 0);
+	for (BucketItem<Priority, Data>* node : nodes)
+	{
+		this->insert_item(node);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::insert_item(BucketItem<Priority, Data>* node)
+{
+	size_t bucket = this->bucket_index(node->priority());
+	BucketItem<Priority, Data>*& head = (*this->buckets_)[bucket];
+	node->bucket() = bucket;
+	if (head)
+	{
+		node->next() = head;
+		node->previous() = head->previous();
+		head->previous()->next() = node;
+		head->previous() = node;
+	}
+	else
+	{
+		node->next() = node->previous() = node;
+		head = node;
+		(*this->occupancy_)[bucket / WORD_SIZE] |= 1ULL << (bucket % WORD_SIZE);
+		(*this->summary_)[bucket / (WORD_SIZE * WORD_SIZE)] |= 1ULL << (bucket / WORD_SIZE % WORD_SIZE);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::remove_item(BucketItem<Priority, Data>* node)
+{
+	size_t bucket = node->bucket();
+	BucketItem<Priority, Data>*& head = (*this->buckets_)[bucket];
+	if (node->next() == node)
+	{
+		head = nullptr;
+		unsigned long long& word = (*this->occupancy_)[bucket / WORD_SIZE];
+		word &= ~(1ULL << (bucket % WORD_SIZE));
+		if (!word)
+		{
+			(*this->summary_)[bucket / (WORD_SIZE * WORD_SIZE)] &= ~(1ULL << (bucket / WORD_SIZE % WORD_SIZE));
+		}
+	}
+	else
+	{
+		node->previous()->next() = node->next();
+		node->next()->previous() = node->previous();
+		if (head == node)
+		{
+			head = node->next();
+		}
+	}
+	node->next() = node->previous() = node;
+}
+
+template<typename Priority, typename Data>
+inline size_t BucketQueue<Priority, Data>::find_first_bucket(size_t from)
+{
+	size_t word = from / WORD_SIZE, bucket_count = this->buckets_->size();
+	if (from >= bucket_count)
+	{
+		return bucket_count;
+	}
+	unsigned long long bits = (*this->occupancy_)[word] & (~0ULL << (from % WORD_SIZE));
+	if (bits)
+	{
+		return word * WORD_SIZE + find_first_set(bits);
+	}
+	for (size_t summary_word = ++word / WORD_SIZE; word < this->occupancy_->size(); word = ++summary_word * WORD_SIZE)
+	{
+		bits = (*this->summary_)[summary_word] & (~0ULL << (word % WORD_SIZE));
+		if (bits)
+		{
+			word = summary_word * WORD_SIZE + find_first_set(bits);
+			return word * WORD_SIZE + find_first_set((*this->occupancy_)[word]);
+		}
+	}
+	return bucket_count;
+}
+
+template<typename Priority, typename Data>
+inline size_t BucketQueue<Priority, Data>::find_first_set(unsigned long long word)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)word))
+	{
+		return index;
+	}
+	_BitScanForward(&index, (unsigned long)(word >> 32));
+	return index + 32;
+#else
+	return __builtin_ctzll(word);
+#endif
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>* node)
+{
+	BucketItem<Priority, Data>* casted_node = (BucketItem<Priority, Data>*)node;
+	this->remove_item(casted_node);
+	this->insert_item(casted_node);
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueue<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>* node)
+{
+	BucketItem<Priority, Data>* casted_node = (BucketItem<Priority, Data>*)node;
+	this->remove_item(casted_node);
+	this->insert_item(casted_node);
+}
+
+template<typename Priority, typename Data>
+inline BucketQueueBounded<Priority, Data>::BucketQueueBounded(const Priority& minimal_priority, const Priority& maximal_priority) :
+	BucketQueue<Priority, Data>((size_t)(maximal_priority - minimal_priority) + 1), minimal_priority_(minimal_priority)
+{
+}
+
+template<typename Priority, typename Data>
+inline BucketQueueBounded<Priority, Data>::~BucketQueueBounded()
+{
+}
+
+template<typename Priority, typename Data>
+inline size_t BucketQueueBounded<Priority, Data>::bucket_index(const Priority& priority)
+{
+	return (size_t)(priority - this->minimal_priority_);
+}
+
+template<typename Priority, typename Data>
+inline bool BucketQueueBounded<Priority, Data>::in_range(const Priority& priority)
+{
+	return priority >= this->minimal_priority_ && (size_t)(priority - this->minimal_priority_) < this->buckets_->size();
+}
+
+template<typename Priority, typename Data>
+inline BucketItem<Priority, Data>* BucketQueueBounded<Priority, Data>::minimal_item()
+{
+	return (*this->buckets_)[this->find_first_bucket(0)];
+}
+
+template<typename Priority, typename Data>
+inline BucketQueueCalendar<Priority, Data>::BucketQueueCalendar(const Priority& width) :
+	BucketQueue<Priority, Data>(MINIMAL_BUCKET_COUNT), width_(width > 0 ? width : 1), current_day_(0)
+{
+}
+
+template<typename Priority, typename Data>
+inline BucketQueueCalendar<Priority, Data>::~BucketQueueCalendar()
+{
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::clear()
+{
+	this->BucketQueue<Priority, Data>::clear();
+	this->current_day_ = 0;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
+{
+	this->BucketQueue<Priority, Data>::push(identifier, priority, data, data_item);
+	this->move_current_day((BucketItem<Priority, Data>*)data_item);
+	if (this->size_ > 2 * this->buckets_->size())
+	{
+		this->resize();
+	}
+}
+
+template<typename Priority, typename Data>
+inline Data BucketQueueCalendar<Priority, Data>::pop(int& identifier)
+{
+	Data data = this->BucketQueue<Priority, Data>::pop(identifier);
+	if (this->buckets_->size() > MINIMAL_BUCKET_COUNT && this->size_ < this->buckets_->size() / 2)
+	{
+		this->resize();
+	}
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	this->BucketQueue<Priority, Data>::erase(node);
+	if (this->buckets_->size() > MINIMAL_BUCKET_COUNT && this->size_ < this->buckets_->size() / 2)
+	{
+		this->resize();
+	}
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
+{
+	this->BucketQueue<Priority, Data>::merge(other_heap);
+	this->resize();
+}
+
+template<typename Priority, typename Data>
+inline size_t BucketQueueCalendar<Priority, Data>::bucket_index(const Priority& priority)
+{
+	return (size_t)(priority / this->width_) & (this->buckets_->size() - 1);
+}
+
+template<typename Priority, typename Data>
+inline bool BucketQueueCalendar<Priority, Data>::in_range(const Priority& priority)
+{
+	return priority >= 0;
+}
+
+template<typename Priority, typename Data>
+inline BucketItem<Priority, Data>* BucketQueueCalendar<Priority, Data>::minimal_item()
+{
+	size_t bucket_count = this->buckets_->size(), bucket = (size_t)this->current_day_ & (bucket_count - 1), next_bucket;
+	Priority day = this->current_day_;
+	BucketItem<Priority, Data>* node_ptr, * minimal_node;
+	for (size_t distance = 0; distance < bucket_count; )
+	{
+		next_bucket = this->find_first_bucket(bucket);
+		if (next_bucket == bucket_count)
+		{
+			next_bucket = this->find_first_bucket(0) + bucket_count;
+		}
+		distance += next_bucket - bucket;
+		day += (Priority)(next_bucket - bucket);
+		bucket = next_bucket & (bucket_count - 1);
+		if (distance >= bucket_count)
+		{
+			break;
+		}
+		minimal_node = nullptr;
+		node_ptr = (*this->buckets_)[bucket];
+		do
+		{
+			if (node_ptr->priority() / this->width_ == day && (!minimal_node || *node_ptr < *minimal_node))
+			{
+				minimal_node = node_ptr;
+			}
+			node_ptr = node_ptr->next();
+		} while (node_ptr != (*this->buckets_)[bucket]);
+		if (minimal_node)
+		{
+			this->current_day_ = day;
+			return minimal_node;
+		}
+		bucket = (bucket + 1) & (bucket_count - 1);
+		day++;
+		distance++;
+	}
+
+	minimal_node = nullptr;
+	for (bucket = this->find_first_bucket(0); bucket < bucket_count; bucket = this->find_first_bucket(bucket + 1))
+	{
+		node_ptr = (*this->buckets_)[bucket];
+		do
+		{
+			if (!minimal_node || *node_ptr < *minimal_node)
+			{
+				minimal_node = node_ptr;
+			}
+			node_ptr = node_ptr->next();
+		} while (node_ptr != (*this->buckets_)[bucket]);
+	}
+	this->current_day_ = minimal_node->priority() / this->width_;
+	return minimal_node;
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>* node)
+{
+	this->BucketQueue<Priority, Data>::priority_was_increased(node);
+	this->move_current_day((BucketItem<Priority, Data>*)node);
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::move_current_day(BucketItem<Priority, Data>* node)
+{
+	Priority day = node->priority() / this->width_;
+	if (day < this->current_day_ || this->size_ == 1)
+	{
+		this->current_day_ = day;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void BucketQueueCalendar<Priority, Data>::resize()
+{
+	size_t bucket_count = MINIMAL_BUCKET_COUNT;
+	while (bucket_count < this->size_)
+	{
+		bucket_count *= 2;
+	}
+	if (this->size_ > 1)
+	{
+		Priority minimal_priority = 0, maximal_priority = 0;
+		bool first = true;
+		BucketItem<Priority, Data>* node_ptr;
+		for (size_t bucket = this->find_first_bucket(0); bucket < this->buckets_->size(); bucket = this->find_first_bucket(bucket + 1))
+		{
+			node_ptr = (*this->buckets_)[bucket];
+			do
+			{
+				if (first || node_ptr->priority() < minimal_priority)
+				{
+					minimal_priority = node_ptr->priority();
+				}
+				if (first || node_ptr->priority() > maximal_priority)
+				{
+					maximal_priority = node_ptr->priority();
+				}
+				first = false;
+				node_ptr = node_ptr->next();
+			} while (node_ptr != (*this->buckets_)[bucket]);
+		}
+		double width = 3.0 * ((double)maximal_priority - (double)minimal_priority) / this->size_;
+		this->width_ = width < 1.0 ? 1 : (Priority)width;
+		this->current_day_ = minimal_priority / this->width_;
+	}
+	this->rebuild(bucket_count);
+}
@@ -0,0 +1,891 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+/// <summary>
+/// Uzol kompaktnej provacej haldy, uzly s uloen v poli a prepojen 32-bitovmi indexmi, nem tabuku virtulnych metd
+/// Vznam prepojen je rovnak ako v BinaryTreeItem, parent_ je predchdzajci srodenec alebo priamy predok prvho syna
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+struct CompactPairingNode
+{
+	Priority priority_;
+	Data data_;
+	int identifier_;
+	uint32_t parent_;
+	uint32_t left_son_;
+	uint32_t right_son_;
+};
+
+/// <summary>
+/// Uzol kompaktnej Fibonacciho haldy, srodenci tvoria kruhov obojsmern zoznam, left_son_ je ubovon syn
+/// Najvy bit degree_ je prznak straty syna, ostatn bity s stupe
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+struct CompactFibonacciNode
+{
+	Priority priority_;
+	Data data_;
+	int identifier_;
+	uint32_t parent_;
+	uint32_t left_son_;
+	uint32_t left_;
+	uint32_t right_;
+	uint32_t degree_;
+};
+
+/// <summary>
+/// Abstraktn predok pre prioritn fronty, ktorch uzly s v jednom poli a odkazuj sa 32-bitovmi indexmi
+/// Index uzla je stly poas jeho ivota a sli ako rukov pre zmenu priority a odstrnenie, zruen uzly sa pouij znova
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+/// <typeparam name="Node">Dtov typ uzla</typeparam>
+template <typename Priority, typename Data, typename Node>
+class CompactPriorityQueue
+{
+protected:
+	/// <summary>
+	/// Pole uzlov
+	/// </summary>
+	std::vector<Node>* nodes_;
+	/// <summary>
+	/// Prv zruen uzol, zruen uzly s zreazen cez parent_
+	/// </summary>
+	uint32_t free_node_;
+	/// <summary>
+	/// Index uzla s najvyou prioritou
+	/// </summary>
+	uint32_t root_;
+	/// <summary>
+	/// Poet prvkov v prioritnom fronte
+	/// </summary>
+	size_t size_;
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	CompactPriorityQueue();
+	/// <summary>
+	/// Vytvor uzol, ak je to mon, pouije zruen uzol
+	/// </summary>
+	/// <param name="identifier">Identifiktor</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Dta</param>
+	/// <returns>Index vytvorenho uzla</returns>
+	uint32_t create_node(const int identifier, const Priority& priority, const Data& data);
+	/// <summary>
+	/// Zru uzol a zarad ho medzi zruen uzly
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	void destroy_node(const uint32_t node);
+	/// <summary>
+	/// Vrti uzol s indexom node
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	/// <returns>Uzol</returns>
+	Node& at(const uint32_t node);
+	/// <summary>
+	/// Vrti, i m uzol first viu prioritu ako uzol second
+	/// </summary>
+	/// <param name="first">Index prvho uzla</param>
+	/// <param name="second">Index druhho uzla</param>
+	/// <returns>True, ak je priorita prvho uzla vyia, alebo je rovn a jeho identifiktor je ni</returns>
+	bool is_higher(const uint32_t first, const uint32_t second);
+	/// <summary>
+	/// Preusporiada front po zven priority uzla
+	/// </summary>
+	/// <param name="node">Index uzla so zvenou prioritou</param>
+	virtual void priority_was_increased(const uint32_t node) = 0;
+	/// <summary>
+	/// Preusporiada front po znen priority uzla
+	/// </summary>
+	/// <param name="node">Index uzla so znenou prioritou</param>
+	virtual void priority_was_decreased(const uint32_t node) = 0;
+public:
+	/// <summary>
+	/// Index, ktor neodkazuje na iadny uzol
+	/// </summary>
+	static constexpr uint32_t NIL = UINT32_MAX;
+	/// <summary>
+	/// Virtulny detruktor
+	/// </summary>
+	virtual ~CompactPriorityQueue();
+	/// <summary>
+	/// Vymae vetky prvky z prioritnho frontu, pole uzlov si ponech kapacitu
+	/// </summary>
+	virtual void clear();
+	/// <summary>
+	/// Vrti poet prvkov v prioritnom fronte
+	/// </summary>
+	/// <returns>Poet prvkov</returns>
+	size_t size() const;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="node">Index vytvorenho uzla</param>
+	virtual void push(const int identifier, const Priority& priority, const Data& data, uint32_t& node) = 0;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	virtual Data pop(int& identifier) = 0;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	virtual Data& find_min();
+	/// <summary>
+	/// Zmen prioritu uzla
+	/// </summary>
+	/// <param name="node">Index uzla, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita uzla</param>
+	void change_priority(const uint32_t node, const Priority& priority);
+	/// <summary>
+	/// Odstrni uzol z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Index odstraovanho uzla</param>
+	virtual void erase(const uint32_t node) = 0;
+	/// <summary>
+	/// Vrti identifiktor prvku v uzle
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	/// <returns>Identifiktor prvku</returns>
+	int identifier(const uint32_t node);
+	/// <summary>
+	/// Vrti prioritu prvku v uzle
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	/// <returns>Priorita prvku</returns>
+	const Priority& priority(const uint32_t node);
+};
+
+/// <summary>
+/// Dvojprechodov provacia halda s kompaktnmi uzlami
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class CompactPairingHeap : public CompactPriorityQueue<Priority, Data, CompactPairingNode<Priority, Data>>
+{
+private:
+	/// <summary>
+	/// Zsobnk stromov pouit pri zluovan, ponechva si kapacitu medzi zluovaniami
+	/// </summary>
+	std::vector<uint32_t>* stack_;
+	/// <summary>
+	/// Zli dva stromy, kore s niou prioritou sa stane prvm synom druhho korea
+	/// </summary>
+	/// <param name="first">Kore prvho stromu alebo NIL</param>
+	/// <param name="second">Kore druhho stromu alebo NIL</param>
+	/// <returns>Kore zlenho stromu</returns>
+	uint32_t merge(uint32_t first, uint32_t second);
+	/// <summary>
+	/// Vystrihne uzol spolu s jeho synmi zo zoznamu srodencov
+	/// </summary>
+	/// <param name="node">Index uzla, ktor nie je koreom</param>
+	void cut(const uint32_t node);
+	/// <summary>
+	/// Zli zoznam srodencov zanajci uzlom node dvojprechodovou stratgiou
+	/// </summary>
+	/// <param name="node">Prv uzol v zozname srodencov alebo NIL</param>
+	/// <returns>Kore zlenho stromu</returns>
+	uint32_t create_binary_tree(uint32_t node);
+protected:
+	/// <summary>
+	/// Vystrihne uzol a zli ho s root_
+	/// </summary>
+	/// <param name="node">Index uzla so zvenou prioritou</param>
+	void priority_was_increased(const uint32_t node) override;
+	/// <summary>
+	/// Zli synov uzla a vsledn strom zli s root_, uzol zostane na svojom mieste
+	/// </summary>
+	/// <param name="node">Index uzla so znenou prioritou</param>
+	void priority_was_decreased(const uint32_t node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	CompactPairingHeap();
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~CompactPairingHeap();
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="node">Index vytvorenho uzla</param>
+	void push(const int identifier, const Priority& priority, const Data& data, uint32_t& node) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Odstrni uzol z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Index odstraovanho uzla</param>
+	void erase(const uint32_t node) override;
+};
+
+/// <summary>
+/// Fibonacciho halda s kompaktnmi uzlami
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class CompactFibonacciHeap : public CompactPriorityQueue<Priority, Data, CompactFibonacciNode<Priority, Data>>
+{
+private:
+	/// <summary>
+	/// Bit prznaku straty syna v degree_
+	/// </summary>
+	static constexpr uint32_t FLAG_BIT = 0x80000000u;
+	/// <summary>
+	/// Prznak, e root_ po znen jeho priority nemus by uzlom s najvyou prioritou, minimum sa njde a pri najbliom zluovan
+	/// </summary>
+	bool root_dirty_;
+	/// <summary>
+	/// Korene stromov poas zluovania, ponechva si kapacitu medzi zluovaniami
+	/// </summary>
+	std::vector<uint32_t>* roots_;
+	/// <summary>
+	/// Pole stromov indexovan stupom, mimo zluovania obsahuje len NIL
+	/// </summary>
+	std::vector<uint32_t>* node_list_;
+	/// <summary>
+	/// Spoj kruhov zoznamy, v ktorch s uzly first a second
+	/// </summary>
+	/// <param name="first">Uzol prvho zoznamu</param>
+	/// <param name="second">Uzol druhho zoznamu</param>
+	void splice(const uint32_t first, const uint32_t second);
+	/// <summary>
+	/// Vyrad uzol z kruhovho zoznamu srodencov
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	void unlink(const uint32_t node);
+	/// <summary>
+	/// Pripoj samostatn uzol do zoznamu koreov
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	void add_root_item(const uint32_t node);
+	/// <summary>
+	/// Pripoj kore node ako syna korea parent
+	/// </summary>
+	/// <param name="node">Index pripjanho uzla</param>
+	/// <param name="parent">Index novho predka</param>
+	void link(const uint32_t node, const uint32_t parent);
+	/// <summary>
+	/// Vystrihne uzol a pripoj ho k zoznamu koreov
+	/// </summary>
+	/// <param name="node">Index vystrihovanho uzla</param>
+	void cut(const uint32_t node);
+	/// <summary>
+	/// Ak je uzol oznaen, vystrihne ho, inak ho ozna
+	/// </summary>
+	/// <param name="node">Index uzla</param>
+	void cascading_cut(const uint32_t node);
+	/// <summary>
+	/// Zli stromy rovnakho stupa a njde kore s najvyou prioritou
+	/// </summary>
+	void consolidate_root();
+	/// <summary>
+	/// Odstrni kore zo zoznamu koreov, jeho synov pripoj ku koreom, zli korene a uzol zru
+	/// </summary>
+	/// <param name="node">Index odstraovanho korea</param>
+	void remove_root(const uint32_t node);
+protected:
+	/// <summary>
+	/// Vystrihne uzol a vykon sriov rez nad priamym predkom
+	/// </summary>
+	/// <param name="node">Index uzla so zvenou prioritou</param>
+	void priority_was_increased(const uint32_t node) override;
+	/// <summary>
+	/// Vystrihne synov uzla s vyou prioritou, ak je uzol koreom root_, hadanie minima odlo do najbliieho zluovania
+	/// </summary>
+	/// <param name="node">Index uzla so znenou prioritou</param>
+	void priority_was_decreased(const uint32_t node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	CompactFibonacciHeap();
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~CompactFibonacciHeap();
+	/// <summary>
+	/// Vymae vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="node">Index vytvorenho uzla</param>
+	void push(const int identifier, const Priority& priority, const Data& data, uint32_t& node) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Odstrni uzol z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Index odstraovanho uzla</param>
+	void erase(const uint32_t node) override;
+};
+
+template<typename Priority, typename Data, typename Node>
+inline CompactPriorityQueue<Priority, Data, Node>::CompactPriorityQueue() :
+	nodes_(new std::vector<Node>()), free_node_(NIL), root_(NIL), size_(0)
+{
+}
+
+template<typename Priority, typename Data, typename Node>
+inline CompactPriorityQueue<Priority, Data, Node>::~CompactPriorityQueue()
+{
+	delete this->nodes_;
+	this->nodes_ = nullptr;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline void CompactPriorityQueue<Priority, Data, Node>::clear()
+{
+	this->nodes_->clear();
+	this->free_node_ = NIL;
+	this->root_ = NIL;
+	this->size_ = 0;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline size_t CompactPriorityQueue<Priority, Data, Node>::size() const
+{
+	return this->size_;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline uint32_t CompactPriorityQueue<Priority, Data, Node>::create_node(const int identifier, const Priority& priority, const Data& data)
+{
+	uint32_t node = this->free_node_;
+	if (node == NIL)
+	{
+		node = (uint32_t)this->nodes_->size();
+		this->nodes_->emplace_back();
+	}
+	else
+	{
+		this->free_node_ = this->at(node).parent_;
+	}
+	Node& new_node = this->at(node);
+	new_node = Node();
+	new_node.priority_ = priority;
+	new_node.data_ = data;
+	new_node.identifier_ = identifier;
+	return node;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline void CompactPriorityQueue<Priority, Data, Node>::destroy_node(const uint32_t node)
+{
+	this->at(node).parent_ = this->free_node_;
+	this->free_node_ = node;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline Node& CompactPriorityQueue<Priority, Data, Node>::at(const uint32_t node)
+{
+	return (*this->nodes_)[node];
+}
+
+template<typename Priority, typename Data, typename Node>
+inline bool CompactPriorityQueue<Priority, Data, Node>::is_higher(const uint32_t first, const uint32_t second)
+{
+	Node& first_node = this->at(first), & second_node = this->at(second);
+	return first_node.priority_ <= second_node.priority_ && (first_node.priority_ < second_node.priority_ || first_node.identifier_ <= second_node.identifier_);
+}
+
+template<typename Priority, typename Data, typename Node>
+inline Data& CompactPriorityQueue<Priority, Data, Node>::find_min()
+{
+	if (this->root_ == NIL)
+	{
+		throw new std::out_of_range("CompactPriorityQueue<Priority, Data, Node>::find_min(): Zoznam je prazdny");
+	}
+	return this->at(this->root_).data_;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline void CompactPriorityQueue<Priority, Data, Node>::change_priority(const uint32_t node, const Priority& priority)
+{
+	Priority old_priority = this->at(node).priority_;
+	this->at(node).priority_ = priority;
+	if (priority < old_priority)
+	{
+		this->priority_was_increased(node);
+	}
+	else if (priority > old_priority)
+	{
+		this->priority_was_decreased(node);
+	}
+}
+
+template<typename Priority, typename Data, typename Node>
+inline int CompactPriorityQueue<Priority, Data, Node>::identifier(const uint32_t node)
+{
+	return this->at(node).identifier_;
+}
+
+template<typename Priority, typename Data, typename Node>
+inline const Priority& CompactPriorityQueue<Priority, Data, Node>::priority(const uint32_t node)
+{
+	return this->at(node).priority_;
+}
+
+template<typename Priority, typename Data>
+inline CompactPairingHeap<Priority, Data>::CompactPairingHeap() :
+	CompactPriorityQueue<Priority, Data, CompactPairingNode<Priority, Data>>(), stack_(new std::vector<uint32_t>())
+{
+}
+
+template<typename Priority, typename Data>
+inline CompactPairingHeap<Priority, Data>::~CompactPairingHeap()
+{
+	delete this->stack_;
+	this->stack_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline uint32_t CompactPairingHeap<Priority, Data>::merge(uint32_t first, uint32_t second)
+{
+	if (first == this->NIL)
+	{
+		return second;
+	}
+	if (second == this->NIL)
+	{
+		return first;
+	}
+	if (this->is_higher(second, first))
+	{
+		std::swap(first, second);
+	}
+	CompactPairingNode<Priority, Data>& parent = this->at(first), & son = this->at(second);
+	son.right_son_ = parent.left_son_;
+	if (parent.left_son_ != this->NIL)
+	{
+		this->at(parent.left_son_).parent_ = second;
+	}
+	son.parent_ = first;
+	parent.left_son_ = second;
+	return first;
+}
+
+template<typename Priority, typename Data>
+inline void CompactPairingHeap<Priority, Data>::cut(const uint32_t node)
+{
+	CompactPairingNode<Priority, Data>& cut_node = this->at(node), & parent = this->at(cut_node.parent_);
+	if (parent.left_son_ == node)
+	{
+		parent.left_son_ = cut_node.right_son_;
+	}
+	else
+	{
+		parent.right_son_ = cut_node.right_son_;
+	}
+	if (cut_node.right_son_ != this->NIL)
+	{
+		this->at(cut_node.right_son_).parent_ = cut_node.parent_;
+	}
+	cut_node.parent_ = this->NIL;
+	cut_node.right_son_ = this->NIL;
+}
+
+template<typename Priority, typename Data>
+inline uint32_t CompactPairingHeap<Priority, Data>::create_binary_tree(uint32_t node)
+{
+	if (node == this->NIL)
+	{
+		return node;
+	}
+	if (this->at(node).right_son_ != this->NIL)
+	{
+		while (node != this->NIL)
+		{
+			uint32_t sibling = this->at(node).right_son_, node_next = this->NIL;
+			this->at(node).right_son_ = this->NIL;
+			if (sibling != this->NIL)
+			{
+				node_next = this->at(sibling).right_son_;
+				this->at(sibling).right_son_ = this->NIL;
+			}
+			this->stack_->push_back(this->merge(node, sibling));
+			node = node_next;
+		}
+		node = this->stack_->back();
+		this->stack_->pop_back();
+		while (!this->stack_->empty())
+		{
+			node = this->merge(node, this->stack_->back());
+			this->stack_->pop_back();
+		}
+	}
+	this->at(node).parent_ = this->NIL;
+	return node;
+}
+
+template<typename Priority, typename Data>
+inline void CompactPairingHeap<Priority, Data>::priority_was_increased(const uint32_t node)
+{
+	if (node != this->root_)
+	{
+		this->cut(node);
+		this->root_ = this->merge(this->root_, node);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactPairingHeap<Priority, Data>::priority_was_decreased(const uint32_t node)
+{
+	uint32_t sons = this->at(node).left_son_;
+	if (sons == this->NIL)
+	{
+		return;
+	}
+	this->at(node).left_son_ = this->NIL;
+	this->root_ = this->merge(this->root_, this->create_binary_tree(sons));
+}
+
+template<typename Priority, typename Data>
+inline void CompactPairingHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, uint32_t& node)
+{
+	node = this->create_node(identifier, priority, data);
+	this->at(node).parent_ = this->NIL;
+	this->at(node).left_son_ = this->NIL;
+	this->at(node).right_son_ = this->NIL;
+	this->root_ = this->merge(this->root_, node);
+	this->size_++;
+}
+
+template<typename Priority, typename Data>
+inline Data CompactPairingHeap<Priority, Data>::pop(int& identifier)
+{
+	if (this->root_ == this->NIL)
+	{
+		throw new std::out_of_range("CompactPairingHeap<Priority, Data>::pop(): Zoznam je prazdny");
+	}
+	uint32_t root = this->root_;
+	identifier = this->at(root).identifier_;
+	Data data = this->at(root).data_;
+	this->root_ = this->create_binary_tree(this->at(root).left_son_);
+	this->destroy_node(root);
+	this->size_--;
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline void CompactPairingHeap<Priority, Data>::erase(const uint32_t node)
+{
+	if (node == this->root_)
+	{
+		this->root_ = this->create_binary_tree(this->at(node).left_son_);
+	}
+	else
+	{
+		this->cut(node);
+		this->root_ = this->merge(this->root_, this->create_binary_tree(this->at(node).left_son_));
+	}
+	this->destroy_node(node);
+	this->size_--;
+}
+
+template<typename Priority, typename Data>
+inline CompactFibonacciHeap<Priority, Data>::CompactFibonacciHeap() :
+	CompactPriorityQueue<Priority, Data, CompactFibonacciNode<Priority, Data>>(), root_dirty_(false),
+	roots_(new std::vector<uint32_t>()), node_list_(new std::vector<uint32_t>())
+{
+}
+
+template<typename Priority, typename Data>
+inline CompactFibonacciHeap<Priority, Data>::~CompactFibonacciHeap()
+{
+	delete this->roots_;
+	delete this->node_list_;
+	this->roots_ = nullptr;
+	this->node_list_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::clear()
+{
+	this->CompactPriorityQueue<Priority, Data, CompactFibonacciNode<Priority, Data>>::clear();
+	this->root_dirty_ = false;
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::splice(const uint32_t first, const uint32_t second)
+{
+	CompactFibonacciNode<Priority, Data>& first_node = this->at(first), & second_node = this->at(second);
+	uint32_t first_right = first_node.right_, second_left = second_node.left_;
+	first_node.right_ = second;
+	second_node.left_ = first;
+	this->at(first_right).left_ = second_left;
+	this->at(second_left).right_ = first_right;
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::unlink(const uint32_t node)
+{
+	CompactFibonacciNode<Priority, Data>& unlinked_node = this->at(node);
+	this->at(unlinked_node.left_).right_ = unlinked_node.right_;
+	this->at(unlinked_node.right_).left_ = unlinked_node.left_;
+	unlinked_node.left_ = node;
+	unlinked_node.right_ = node;
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::add_root_item(const uint32_t node)
+{
+	this->at(node).parent_ = this->NIL;
+	if (this->root_ == this->NIL)
+	{
+		this->root_ = node;
+		return;
+	}
+	this->splice(this->root_, node);
+	if (this->is_higher(node, this->root_))
+	{
+		this->root_ = node;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::link(const uint32_t node, const uint32_t parent)
+{
+	CompactFibonacciNode<Priority, Data>& parent_node = this->at(parent);
+	this->at(node).parent_ = parent;
+	this->at(node).degree_ &= ~FLAG_BIT;
+	if (parent_node.left_son_ == this->NIL)
+	{
+		parent_node.left_son_ = node;
+	}
+	else
+	{
+		this->splice(parent_node.left_son_, node);
+	}
+	parent_node.degree_++;
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::cut(const uint32_t node)
+{
+	CompactFibonacciNode<Priority, Data>& parent = this->at(this->at(node).parent_);
+	if (parent.left_son_ == node)
+	{
+		parent.left_son_ = this->at(node).right_ == node ? this->NIL : this->at(node).right_;
+	}
+	parent.degree_--;
+	this->unlink(node);
+	this->at(node).degree_ &= ~FLAG_BIT;
+	this->add_root_item(node);
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::cascading_cut(const uint32_t node)
+{
+	uint32_t parent = this->at(node).parent_;
+	if (parent != this->NIL)
+	{
+		if (this->at(node).degree_ & FLAG_BIT)
+		{
+			this->cut(node);
+			this->cascading_cut(parent);
+		}
+		else
+		{
+			this->at(node).degree_ |= FLAG_BIT;
+		}
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::consolidate_root()
+{
+	std::vector<uint32_t>& roots = *this->roots_, & node_list = *this->node_list_;
+	this->root_dirty_ = false;
+	if (this->root_ == this->NIL)
+	{
+		return;
+	}
+	uint32_t node = this->root_;
+	do
+	{
+		roots.push_back(node);
+		node = this->at(node).right_;
+	} while (node != this->root_);
+
+	for (uint32_t root : roots)
+	{
+		CompactFibonacciNode<Priority, Data>& root_node = this->at(root);
+		root_node.left_ = root;
+		root_node.right_ = root;
+		uint32_t degree = root_node.degree_ & ~FLAG_BIT;
+		node = root;
+		while (degree < node_list.size() && node_list[degree] != this->NIL)
+		{
+			uint32_t other = node_list[degree];
+			node_list[degree++] = this->NIL;
+			if (this->is_higher(other, node))
+			{
+				std::swap(node, other);
+			}
+			this->link(other, node);
+		}
+		if (degree >= node_list.size())
+		{
+			node_list.resize(degree + 1, this->NIL);
+		}
+		node_list[degree] = node;
+	}
+	roots.clear();
+
+	this->root_ = this->NIL;
+	for (uint32_t& tree : node_list)
+	{
+		if (tree != this->NIL)
+		{
+			this->add_root_item(tree);
+			tree = this->NIL;
+		}
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::remove_root(const uint32_t node)
+{
+	CompactFibonacciNode<Priority, Data>& root_node = this->at(node);
+	if (root_node.left_son_ != this->NIL)
+	{
+		uint32_t son = root_node.left_son_;
+		do
+		{
+			this->at(son).parent_ = this->NIL;
+			this->at(son).degree_ &= ~FLAG_BIT;
+			son = this->at(son).right_;
+		} while (son != root_node.left_son_);
+		this->splice(node, root_node.left_son_);
+	}
+	this->root_ = root_node.right_ == node ? this->NIL : root_node.right_;
+	this->unlink(node);
+	this->destroy_node(node);
+	this->size_--;
+	this->consolidate_root();
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::priority_was_increased(const uint32_t node)
+{
+	uint32_t parent = this->at(node).parent_;
+	if (parent != this->NIL && this->is_higher(node, parent))
+	{
+		this->cut(node);
+		this->cascading_cut(parent);
+	}
+	if (this->at(node).parent_ == this->NIL && this->is_higher(node, this->root_))
+	{
+		this->root_ = node;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::priority_was_decreased(const uint32_t node)
+{
+	if (this->root_ == node)
+	{
+		this->root_dirty_ = true;
+	}
+	uint32_t son = this->at(node).left_son_;
+	for (uint32_t i = this->at(node).degree_ & ~FLAG_BIT; i > 0; i--)
+	{
+		uint32_t son_next = this->at(son).right_;
+		if (this->is_higher(son, node))
+		{
+			this->cut(son);
+			this->cascading_cut(node);
+		}
+		son = son_next;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, uint32_t& node)
+{
+	node = this->create_node(identifier, priority, data);
+	this->at(node).left_son_ = this->NIL;
+	this->at(node).left_ = node;
+	this->at(node).right_ = node;
+	this->at(node).degree_ = 0;
+	this->add_root_item(node);
+	this->size_++;
+}
+
+template<typename Priority, typename Data>
+inline Data CompactFibonacciHeap<Priority, Data>::pop(int& identifier)
+{
+	if (this->root_ == this->NIL)
+	{
+		throw new std::out_of_range("CompactFibonacciHeap<Priority, Data>::pop(): Zoznam je prazdny");
+	}
+	if (this->root_dirty_)
+	{
+		this->consolidate_root();
+	}
+	uint32_t root = this->root_;
+	identifier = this->at(root).identifier_;
+	Data data = this->at(root).data_;
+	this->remove_root(root);
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline Data& CompactFibonacciHeap<Priority, Data>::find_min()
+{
+	if (this->root_dirty_)
+	{
+		this->consolidate_root();
+	}
+	return this->CompactPriorityQueue<Priority, Data, CompactFibonacciNode<Priority, Data>>::find_min();
+}
+
+template<typename Priority, typename Data>
+inline void CompactFibonacciHeap<Priority, Data>::erase(const uint32_t node)
+{
+	uint32_t parent = this->at(node).parent_;
+	if (parent != this->NIL)
+	{
+		this->cut(node);
+		this->cascading_cut(parent);
+	}
+	this->remove_root(node);
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include "PriorityQueue.h"
+#include <mutex>
+
+/// <summary>
+/// Abstraktn predok pre prioritn fronty, ku ktorm me sasne pristupova viac vlkien
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class ConcurrentPriorityQueue
+{
+protected:
+	/// <summary>
+	/// Abstraktn kontruktor
+	/// </summary>
+	ConcurrentPriorityQueue();
+public:
+	/// <summary>
+	/// Virtulny detruktor
+	/// </summary>
+	virtual ~ConcurrentPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu, nesmie prebieha sasne s inmi operciami
+	/// </summary>
+	virtual void clear() = 0;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	virtual void push(const int identifier, const Priority& priority, const Data& data) = 0;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou, ak nie je przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran</returns>
+	virtual bool try_pop(int& identifier, Data& data) = 0;
+};
+
+/// <summary>
+/// Prioritn front, ku ktormu je sben prstup serializovan zmkom
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class LockedPriorityQueue : public ConcurrentPriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Obalen prioritn front
+	/// </summary>
+	PriorityQueue<Priority, Data>* priority_queue_;
+	/// <summary>
+	/// Zmok chrniaci prioritn front
+	/// </summary>
+	std::mutex* mutex_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="priority_queue">Obalen prioritn front, ktorho vlastnctvo preber</param>
+	LockedPriorityQueue(PriorityQueue<Priority, Data>* priority_queue);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~LockedPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou, ak nie je przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran</returns>
+	bool try_pop(int& identifier, Data& data) override;
+};
+
+template<typename Priority, typename Data>
+inline ConcurrentPriorityQueue<Priority, Data>::ConcurrentPriorityQueue()
+{
+}
+
+template<typename Priority, typename Data>
+inline ConcurrentPriorityQueue<Priority, Data>::~ConcurrentPriorityQueue()
+{
+}
+
+template<typename Priority, typename Data>
+inline LockedPriorityQueue<Priority, Data>::LockedPriorityQueue(PriorityQueue<Priority, Data>* priority_queue) :
+	ConcurrentPriorityQueue<Priority, Data>(),
+	priority_queue_(priority_queue),
+	mutex_(new std::mutex())
+{
+}
+
+template<typename Priority, typename Data>
+inline LockedPriorityQueue<Priority, Data>::~LockedPriorityQueue()
+{
+	delete this->priority_queue_;
+	delete this->mutex_;
+	this->priority_queue_ = nullptr;
+	this->mutex_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline void LockedPriorityQueue<Priority, Data>::clear()
+{
+	std::lock_guard<std::mutex> lock(*this->mutex_);
+	this->priority_queue_->clear();
+}
+
+template<typename Priority, typename Data>
+inline void LockedPriorityQueue<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	PriorityQueueItem<Priority, Data>* priority_queue_item;
+	std::lock_guard<std::mutex> lock(*this->mutex_);
+	this->priority_queue_->push(identifier, priority, data, priority_queue_item);
+}
+
+template<typename Priority, typename Data>
+inline bool LockedPriorityQueue<Priority, Data>::try_pop(int& identifier, Data& data)
+{
+	std::lock_guard<std::mutex> lock(*this->mutex_);
+	if (this->priority_queue_->size() == 0)
+	{
+		return false;
+	}
+	data = this->priority_queue_->pop(identifier);
+	return true;
+}
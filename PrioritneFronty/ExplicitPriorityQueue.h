@@ -38,6 +38,11 @@ public:
 	/// </summary>
 	/// <returns>Hodnota dt</returns>
 	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
 };
 
 template<typename Priority, typename Data>
@@ -66,3 +71,13 @@ inline Data& ExplicitPriorityQueue<Priority, Data>::find_min()
 	}
 	return this->root_->data();
 }
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* ExplicitPriorityQueue<Priority, Data>::find_min_item()
+{
+	if (this->size_ == 0)
+	{
+		throw new std::out_of_range("ExplicitPriorityQueue<Priority, Data>::find_min_item(): Zoznam je prazdny");
+	}
+	return this->root_;
+}
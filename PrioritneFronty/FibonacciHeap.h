@@ -32,7 +32,7 @@ protected:
 	/// <param name="node">Prvok so zvenou prioritou</param>
 	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
 	/// <summary>
-	/// Vystrihne potomkov prvku s vyou prioritou
+	/// Vystrihne potomkov prvku s vyou prioritou, ak je prvok koreom root_, hadanie minima odlo do najbliieho zluovania
 	/// </summary>
 	/// <param name="node">Prvok so znenou prioritou</param>
 	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
@@ -60,6 +60,11 @@ public:
 	/// <returns>Hodnota dt</returns>
 	Data pop(int& identifier) override { return this->LazyBinomialHeap<Priority, Data>::pop(identifier); };
 	/// <summary>
+	/// Vystrihne prvok so sriovm rezom nad priamym predkom, odstrni ho zo zoznamu koreov a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
 	/// Zmen prioritu prvku
 	/// </summary>
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
@@ -81,7 +86,7 @@ inline FibonacciHeap<Priority, Data>::~FibonacciHeap()
 template<typename Priority, typename Data>
 inline void FibonacciHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
 {
-	data_item = this->LazyBinomialHeap<Priority, Data>::push(new FibonacciHeapItem<Priority, Data>(identifier, priority, data));
+	data_item = this->LazyBinomialHeap<Priority, Data>::push(this->template create_item<FibonacciHeapItem<Priority, Data>>(identifier, priority, data));
 }
 
 template<typename Priority, typename Data>
@@ -111,6 +116,20 @@ inline void FibonacciHeap<Priority, Data>::cascading_cut(FibonacciHeapItem<Prior
 	}
 }
 
+template<typename Priority, typename Data>
+inline void FibonacciHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	FibonacciHeapItem<Priority, Data>* casted_node = (FibonacciHeapItem<Priority, Data>*)node;
+	if (casted_node->ordered_ancestor())
+	{
+		FibonacciHeapItem<Priority, Data>* ordered_ancestor = (FibonacciHeapItem<Priority, Data>*)casted_node->ordered_ancestor();
+		this->cut(casted_node);
+		this->cascading_cut(ordered_ancestor);
+	}
+	this->remove_root(casted_node);
+	this->destroy_item(casted_node);
+}
+
 template<typename Priority, typename Data>
 inline void FibonacciHeap<Priority, Data>::consolidate_root(BinaryTreeItem<Priority, Data>* node)
 {
@@ -127,7 +146,7 @@ inline void FibonacciHeap<Priority, Data>::priority_was_increased(PriorityQueueI
 		this->cut(casted_node);
 		this->cascading_cut(ordered_ancestor);
 	}
-	if (*casted_node < *this->root_)
+	if (!casted_node->ordered_ancestor() && *casted_node < *this->root_)
 	{
 		this->root_ = casted_node;
 	}
@@ -140,15 +159,7 @@ inline void FibonacciHeap<Priority, Data>::priority_was_decreased(PriorityQueueI
 	FibonacciHeapItem<Priority, Data>* ordered_ancestor;
 	if (this->root_ == casted_node)
 	{
-		BinaryTreeItem<Priority, Data>* new_root = this->root_;
-		for (BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son(); node_ptr != this->root_; node_ptr = node_ptr->right_son())
-		{
-			if (*node_ptr < *new_root)
-			{
-				new_root = node_ptr;
-			}
-		}
-		this->root_ = new_root;
+		this->root_dirty_ = true;
 	}
 	for (BinaryTreeItem<Priority, Data>* node_ptr = casted_node->left_son(), *node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr; node_ptr;
 		node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
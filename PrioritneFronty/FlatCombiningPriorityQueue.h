@@ -0,0 +1,366 @@
+#pragma once
+#include "ConcurrentPriorityQueue.h"
+#include "BinaryHeap.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Stav zverejnenej poiadavky
+/// </summary>
+enum class FlatCombiningState
+{
+	/// <summary>
+	/// Slot nepouva iadne vlkno
+	/// </summary>
+	FREE,
+	/// <summary>
+	/// Vlkno zapisuje poiadavku do slotu
+	/// </summary>
+	CLAIMED,
+	/// <summary>
+	/// Poiadavka ak na vykonanie kombinujcim vlknom
+	/// </summary>
+	PENDING,
+	/// <summary>
+	/// Poiadavka bola vykonan, vsledok je v slote
+	/// </summary>
+	DONE
+};
+
+/// <summary>
+/// Slot, cez ktor vlkno zverejn poiadavku kombinujcemu vlknu
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class alignas(64) FlatCombiningSlot
+{
+private:
+	/// <summary>
+	/// Stav poiadavky
+	/// </summary>
+	std::atomic<FlatCombiningState> state_;
+	/// <summary>
+	/// True pre vloenie, false pre vber
+	/// </summary>
+	bool is_push_;
+	/// <summary>
+	/// Identifiktor vkladanho alebo vybranho prvku
+	/// </summary>
+	int identifier_;
+	/// <summary>
+	/// Priorita vkladanho prvku
+	/// </summary>
+	Priority priority_;
+	/// <summary>
+	/// Dta vkladanho alebo vybranho prvku
+	/// </summary>
+	Data data_;
+	/// <summary>
+	/// Vsledok vberu, false ak bol front przdny
+	/// </summary>
+	bool result_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	FlatCombiningSlot();
+	/// <summary>
+	/// Getter atribtu state_
+	/// </summary>
+	/// <returns>Stav poiadavky</returns>
+	std::atomic<FlatCombiningState>& state();
+	/// <summary>
+	/// Getter atribtu is_push_
+	/// </summary>
+	/// <returns>True pre vloenie</returns>
+	bool& is_push();
+	/// <summary>
+	/// Getter atribtu identifier_
+	/// </summary>
+	/// <returns>Identifiktor prvku</returns>
+	int& identifier();
+	/// <summary>
+	/// Getter atribtu priority_
+	/// </summary>
+	/// <returns>Priorita prvku</returns>
+	Priority& priority();
+	/// <summary>
+	/// Getter atribtu data_
+	/// </summary>
+	/// <returns>Dta prvku</returns>
+	Data& data();
+	/// <summary>
+	/// Getter atribtu result_
+	/// </summary>
+	/// <returns>Vsledok vberu</returns>
+	bool& result();
+};
+
+/// <summary>
+/// Sben prioritn front s plochm kombinovanm (flat combining) poda Hendler a kol. (2010)
+/// Vlkna zverejuj poiadavky v slotoch, jedno z nich zska prznak kombinovania a vykon vetky zverejnen
+/// poiadavky naraz, vloenia ako dvku cez push_batch, ostatn vlkna medzitm akaj na svojom slote
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+/// <typeparam name="Heap">Obalen prioritn front</typeparam>
+template <typename Priority, typename Data, template <typename, typename> class Heap = BinaryHeap>
+class FlatCombiningPriorityQueue : public ConcurrentPriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Poet prechodov cez sloty, ktor kombinujce vlkno urob, km prznak uvon
+	/// </summary>
+	static const int COMBINING_PASSES = 2;
+	/// <summary>
+	/// Obalen prioritn front, men ho iba kombinujce vlkno
+	/// </summary>
+	Heap<Priority, Data>* priority_queue_;
+	/// <summary>
+	/// Sloty poiadaviek
+	/// </summary>
+	std::vector<FlatCombiningSlot<Priority, Data>*>* slots_;
+	/// <summary>
+	/// Dvka vloen zostaven kombinujcim vlknom
+	/// </summary>
+	std::vector<PriorityQueueOperation<Priority, Data>>* pushes_;
+	/// <summary>
+	/// Prznak kombinovania, dr ho vlkno, ktor prve vykonva poiadavky
+	/// </summary>
+	alignas(64) std::atomic<bool> combining_;
+	/// <summary>
+	/// Obsad von slot, prednostne ten, ktor vlkno pouilo naposledy
+	/// </summary>
+	/// <returns>Obsaden slot</returns>
+	FlatCombiningSlot<Priority, Data>* claim_slot();
+	/// <summary>
+	/// Zverejn poiadavku v slote a pok, km ju vykon toto alebo in kombinujce vlkno
+	/// </summary>
+	/// <param name="slot">Slot s vyplnenou poiadavkou</param>
+	void execute(FlatCombiningSlot<Priority, Data>* slot);
+	/// <summary>
+	/// Vykon vetky zverejnen poiadavky, volajce vlkno mus dra prznak kombinovania
+	/// </summary>
+	/// <returns>True, ak bola vykonan aspo jedna poiadavka</returns>
+	bool combine();
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="thread_count">Poet vlkien, ktor bud k frontu pristupova</param>
+	FlatCombiningPriorityQueue(const int thread_count);
+	/// <summary>
+	/// Kontruktor pre prioritn fronty, ktor nemaj implicitn kontruktor
+	/// </summary>
+	/// <param name="thread_count">Poet vlkien, ktor bud k frontu pristupova</param>
+	/// <param name="priority_queue">Obalen prioritn front, ktorho vlastnctvo preber</param>
+	FlatCombiningPriorityQueue(const int thread_count, Heap<Priority, Data>* priority_queue);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~FlatCombiningPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou, ak nie je przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran</returns>
+	bool try_pop(int& identifier, Data& data) override;
+};
+
+template<typename Priority, typename Data>
+inline FlatCombiningSlot<Priority, Data>::FlatCombiningSlot() :
+	state_(FlatCombiningState::FREE), is_push_(false), identifier_(0), priority_(Priority()), data_(Data()), result_(false)
+{
+}
+
+template<typename Priority, typename Data>
+inline std::atomic<FlatCombiningState>& FlatCombiningSlot<Priority, Data>::state()
+{
+	return this->state_;
+}
+
+template<typename Priority, typename Data>
+inline bool& FlatCombiningSlot<Priority, Data>::is_push()
+{
+	return this->is_push_;
+}
+
+template<typename Priority, typename Data>
+inline int& FlatCombiningSlot<Priority, Data>::identifier()
+{
+	return this->identifier_;
+}
+
+template<typename Priority, typename Data>
+inline Priority& FlatCombiningSlot<Priority, Data>::priority()
+{
+	return this->priority_;
+}
+
+template<typename Priority, typename Data>
+inline Data& FlatCombiningSlot<Priority, Data>::data()
+{
+	return this->data_;
+}
+
+template<typename Priority, typename Data>
+inline bool& FlatCombiningSlot<Priority, Data>::result()
+{
+	return this->result_;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline FlatCombiningPriorityQueue<Priority, Data, Heap>::FlatCombiningPriorityQueue(const int thread_count) :
+	FlatCombiningPriorityQueue(thread_count, new Heap<Priority, Data>())
+{
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline FlatCombiningPriorityQueue<Priority, Data, Heap>::FlatCombiningPriorityQueue(const int thread_count, Heap<Priority, Data>* priority_queue) :
+	ConcurrentPriorityQueue<Priority, Data>(),
+	priority_queue_(priority_queue),
+	slots_(new std::vector<FlatCombiningSlot<Priority, Data>*>()),
+	pushes_(new std::vector<PriorityQueueOperation<Priority, Data>>()),
+	combining_(false)
+{
+	for (int i = 0; i < std::max(thread_count * 2, 2); i++)
+	{
+		this->slots_->push_back(new FlatCombiningSlot<Priority, Data>());
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline FlatCombiningPriorityQueue<Priority, Data, Heap>::~FlatCombiningPriorityQueue()
+{
+	for (FlatCombiningSlot<Priority, Data>* slot : *this->slots_)
+	{
+		delete slot;
+	}
+	delete this->slots_;
+	delete this->pushes_;
+	delete this->priority_queue_;
+	this->slots_ = nullptr;
+	this->pushes_ = nullptr;
+	this->priority_queue_ = nullptr;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void FlatCombiningPriorityQueue<Priority, Data, Heap>::clear()
+{
+	this->priority_queue_->clear();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void FlatCombiningPriorityQueue<Priority, Data, Heap>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	FlatCombiningSlot<Priority, Data>* slot = this->claim_slot();
+	slot->is_push() = true;
+	slot->identifier() = identifier;
+	slot->priority() = priority;
+	slot->data() = data;
+	this->execute(slot);
+	slot->state().store(FlatCombiningState::FREE, std::memory_order_release);
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline bool FlatCombiningPriorityQueue<Priority, Data, Heap>::try_pop(int& identifier, Data& data)
+{
+	FlatCombiningSlot<Priority, Data>* slot = this->claim_slot();
+	slot->is_push() = false;
+	this->execute(slot);
+	bool result = slot->result();
+	if (result)
+	{
+		identifier = slot->identifier();
+		data = slot->data();
+	}
+	slot->state().store(FlatCombiningState::FREE, std::memory_order_release);
+	return result;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline FlatCombiningSlot<Priority, Data>* FlatCombiningPriorityQueue<Priority, Data, Heap>::claim_slot()
+{
+	static thread_local size_t preferred_slot = std::hash<std::thread::id>()(std::this_thread::get_id());
+	for (size_t i = preferred_slot;; i++)
+	{
+		FlatCombiningSlot<Priority, Data>* slot = (*this->slots_)[i % this->slots_->size()];
+		FlatCombiningState expected = FlatCombiningState::FREE;
+		if (slot->state().load(std::memory_order_relaxed) == FlatCombiningState::FREE &&
+			slot->state().compare_exchange_strong(expected, FlatCombiningState::CLAIMED, std::memory_order_acquire))
+		{
+			preferred_slot = i % this->slots_->size();
+			return slot;
+		}
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void FlatCombiningPriorityQueue<Priority, Data, Heap>::execute(FlatCombiningSlot<Priority, Data>* slot)
+{
+	slot->state().store(FlatCombiningState::PENDING, std::memory_order_release);
+	while (slot->state().load(std::memory_order_acquire) != FlatCombiningState::DONE)
+	{
+		if (!this->combining_.load(std::memory_order_relaxed) && !this->combining_.exchange(true, std::memory_order_acquire))
+		{
+			int pass = 0;
+			while (pass < COMBINING_PASSES && this->combine())
+			{
+				pass++;
+			}
+			this->combining_.store(false, std::memory_order_release);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline bool FlatCombiningPriorityQueue<Priority, Data, Heap>::combine()
+{
+	bool combined = false;
+	this->pushes_->clear();
+	for (FlatCombiningSlot<Priority, Data>* slot : *this->slots_)
+	{
+		if (slot->state().load(std::memory_order_acquire) == FlatCombiningState::PENDING && slot->is_push())
+		{
+			this->pushes_->push_back(PriorityQueueOperation<Priority, Data>(OperationType::PUSH, slot->identifier(), slot->priority(), slot->data()));
+			slot->state().store(FlatCombiningState::DONE, std::memory_order_release);
+			combined = true;
+		}
+	}
+	this->priority_queue_->push_batch(*this->pushes_);
+
+	for (FlatCombiningSlot<Priority, Data>* slot : *this->slots_)
+	{
+		if (slot->state().load(std::memory_order_acquire) == FlatCombiningState::PENDING && !slot->is_push())
+		{
+			slot->result() = this->priority_queue_->size() > 0;
+			if (slot->result())
+			{
+				slot->data() = this->priority_queue_->pop(slot->identifier());
+			}
+			slot->state().store(FlatCombiningState::DONE, std::memory_order_release);
+			combined = true;
+		}
+	}
+	return combined;
+}
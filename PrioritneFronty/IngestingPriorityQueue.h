@@ -0,0 +1,360 @@
+#pragma once
+#include "ConcurrentPriorityQueue.h"
+#include "BinaryHeap.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Bunka kruhovho zsobnka vkladanch prvkov
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class IngestionRingCell
+{
+private:
+	/// <summary>
+	/// Poradov slo bunky, uruje, i je bunka von pre producenta alebo zaplnen pre konzumenta
+	/// </summary>
+	std::atomic<size_t> sequence_;
+	/// <summary>
+	/// Identifiktor vkladanho prvku
+	/// </summary>
+	int identifier_;
+	/// <summary>
+	/// Priorita vkladanho prvku
+	/// </summary>
+	Priority priority_;
+	/// <summary>
+	/// Dta vkladanho prvku
+	/// </summary>
+	Data data_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	IngestionRingCell();
+	/// <summary>
+	/// Getter atribtu sequence_
+	/// </summary>
+	/// <returns>Poradov slo bunky</returns>
+	std::atomic<size_t>& sequence();
+	/// <summary>
+	/// Getter atribtu identifier_
+	/// </summary>
+	/// <returns>Identifiktor prvku</returns>
+	int& identifier();
+	/// <summary>
+	/// Getter atribtu priority_
+	/// </summary>
+	/// <returns>Priorita prvku</returns>
+	Priority& priority();
+	/// <summary>
+	/// Getter atribtu data_
+	/// </summary>
+	/// <returns>Dta prvku</returns>
+	Data& data();
+};
+
+/// <summary>
+/// Ohranien kruhov zsobnk bez zmkov s jednm konzumentom a jednm (SPSC) alebo viacermi (MPSC) producentmi poda Vyukova
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class IngestionRing
+{
+private:
+	/// <summary>
+	/// Bunky zsobnka, ich poet je mocnina dvoch
+	/// </summary>
+	std::vector<IngestionRingCell<Priority, Data>>* cells_;
+	/// <summary>
+	/// Maska indexu bunky
+	/// </summary>
+	size_t mask_;
+	/// <summary>
+	/// True, ak do zsobnka vklad iba jedno vlkno a pozcia sa nemus rezervova cez compare_exchange
+	/// </summary>
+	bool single_producer_;
+	/// <summary>
+	/// Pozcia, na ktor vlo al producent
+	/// </summary>
+	alignas(64) std::atomic<size_t> tail_;
+	/// <summary>
+	/// Pozcia, z ktorej vyberie konzument, men ju iba konzument
+	/// </summary>
+	alignas(64) size_t head_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="capacity">Najmenia kapacita, zaokrhli sa nahor na mocninu dvoch</param>
+	/// <param name="single_producer">True, ak bude do zsobnka vklada iba jedno vlkno</param>
+	IngestionRing(const size_t capacity, const bool single_producer);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~IngestionRing();
+	/// <summary>
+	/// Vlo prvok do zsobnka, vol producent
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <returns>False, ak je zsobnk pln</returns>
+	bool try_push(const int identifier, const Priority& priority, const Data& data);
+	/// <summary>
+	/// Vyberie prvky, ktor s v zsobnku, najviac toko, ak je jeho kapacita, a prid ich ako opercie vloenia, vol konzument
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	/// <returns>Poet vybranch prvkov</returns>
+	size_t drain(std::vector<PriorityQueueOperation<Priority, Data>>& operations);
+};
+
+/// <summary>
+/// Sben prioritn front, do ktorho vkladaj producenti cez kruhov zsobnk a vyber jedin konzument
+/// Konzument pred kadm vberom presunie obsah zsobnka do obalenho prioritnho frontu jednou dvkou cez push_batch,
+/// producenti preto nikdy nepristupuj k pamti prioritnho frontu, try_pop smie vola iba jedno vlkno
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+/// <typeparam name="Heap">Obalen prioritn front</typeparam>
+template <typename Priority, typename Data, template <typename, typename> class Heap = BinaryHeap>
+class IngestingPriorityQueue : public ConcurrentPriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Obalen prioritn front, men ho iba konzument
+	/// </summary>
+	Heap<Priority, Data>* priority_queue_;
+	/// <summary>
+	/// Kruhov zsobnk vkladanch prvkov
+	/// </summary>
+	IngestionRing<Priority, Data>* ring_;
+	/// <summary>
+	/// Dvka vloen vybran zo zsobnka
+	/// </summary>
+	std::vector<PriorityQueueOperation<Priority, Data>>* batch_;
+	/// <summary>
+	/// Presunie obsah zsobnka do prioritnho frontu
+	/// </summary>
+	void drain();
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="capacity">Kapacita kruhovho zsobnka</param>
+	/// <param name="single_producer">True, ak bude vklada iba jedno vlkno</param>
+	IngestingPriorityQueue(const size_t capacity = 4096, const bool single_producer = false);
+	/// <summary>
+	/// Kontruktor pre prioritn fronty, ktor nemaj implicitn kontruktor
+	/// </summary>
+	/// <param name="capacity">Kapacita kruhovho zsobnka</param>
+	/// <param name="single_producer">True, ak bude vklada iba jedno vlkno</param>
+	/// <param name="priority_queue">Obalen prioritn front, ktorho vlastnctvo preber</param>
+	IngestingPriorityQueue(const size_t capacity, const bool single_producer, Heap<Priority, Data>* priority_queue);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~IngestingPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu aj zo zsobnka
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do kruhovho zsobnka, ak je pln, ak, km ho konzument neuvon
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data) override;
+	/// <summary>
+	/// Presunie obsah zsobnka do prioritnho frontu a vyberie dta s najvou prioritou, ak nie je przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran</returns>
+	bool try_pop(int& identifier, Data& data) override;
+};
+
+template<typename Priority, typename Data>
+inline IngestionRingCell<Priority, Data>::IngestionRingCell() :
+	sequence_(0), identifier_(0), priority_(Priority()), data_(Data())
+{
+}
+
+template<typename Priority, typename Data>
+inline std::atomic<size_t>& IngestionRingCell<Priority, Data>::sequence()
+{
+	return this->sequence_;
+}
+
+template<typename Priority, typename Data>
+inline int& IngestionRingCell<Priority, Data>::identifier()
+{
+	return this->identifier_;
+}
+
+template<typename Priority, typename Data>
+inline Priority& IngestionRingCell<Priority, Data>::priority()
+{
+	return this->priority_;
+}
+
+template<typename Priority, typename Data>
+inline Data& IngestionRingCell<Priority, Data>::data()
+{
+	return this->data_;
+}
+
+template<typename Priority, typename Data>
+inline IngestionRing<Priority, Data>::IngestionRing(const size_t capacity, const bool single_producer) :
+	cells_(nullptr),
+	mask_(0),
+	single_producer_(single_producer),
+	tail_(0),
+	head_(0)
+{
+	size_t size = 2;
+	while (size < capacity)
+	{
+		size *= 2;
+	}
+	this->cells_ = new std::vector<IngestionRingCell<Priority, Data>>(size);
+	this->mask_ = size - 1;
+	for (size_t i = 0; i < size; i++)
+	{
+		(*this->cells_)[i].sequence().store(i, std::memory_order_relaxed);
+	}
+}
+
+template<typename Priority, typename Data>
+inline IngestionRing<Priority, Data>::~IngestionRing()
+{
+	delete this->cells_;
+	this->cells_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline bool IngestionRing<Priority, Data>::try_push(const int identifier, const Priority& priority, const Data& data)
+{
+	size_t position = this->tail_.load(std::memory_order_relaxed);
+	IngestionRingCell<Priority, Data>* cell;
+	while (true)
+	{
+		cell = &(*this->cells_)[position & this->mask_];
+		size_t sequence = cell->sequence().load(std::memory_order_acquire);
+		if (sequence == position)
+		{
+			if (this->single_producer_)
+			{
+				this->tail_.store(position + 1, std::memory_order_relaxed);
+				break;
+			}
+			if (this->tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (sequence < position)
+		{
+			return false;
+		}
+		else
+		{
+			position = this->tail_.load(std::memory_order_relaxed);
+		}
+	}
+	cell->identifier() = identifier;
+	cell->priority() = priority;
+	cell->data() = data;
+	cell->sequence().store(position + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename Priority, typename Data>
+inline size_t IngestionRing<Priority, Data>::drain(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	size_t count = 0;
+	while (count <= this->mask_)
+	{
+		IngestionRingCell<Priority, Data>& cell = (*this->cells_)[this->head_ & this->mask_];
+		if (cell.sequence().load(std::memory_order_acquire) != this->head_ + 1)
+		{
+			break;
+		}
+		operations.push_back(PriorityQueueOperation<Priority, Data>(OperationType::PUSH, cell.identifier(), cell.priority(), cell.data()));
+		cell.sequence().store(this->head_ + this->mask_ + 1, std::memory_order_release);
+		this->head_++;
+		count++;
+	}
+	return count;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline IngestingPriorityQueue<Priority, Data, Heap>::IngestingPriorityQueue(const size_t capacity, const bool single_producer) :
+	IngestingPriorityQueue(capacity, single_producer, new Heap<Priority, Data>())
+{
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline IngestingPriorityQueue<Priority, Data, Heap>::IngestingPriorityQueue(const size_t capacity, const bool single_producer, Heap<Priority, Data>* priority_queue) :
+	ConcurrentPriorityQueue<Priority, Data>(),
+	priority_queue_(priority_queue),
+	ring_(new IngestionRing<Priority, Data>(capacity, single_producer)),
+	batch_(new std::vector<PriorityQueueOperation<Priority, Data>>())
+{
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline IngestingPriorityQueue<Priority, Data, Heap>::~IngestingPriorityQueue()
+{
+	delete this->priority_queue_;
+	delete this->ring_;
+	delete this->batch_;
+	this->priority_queue_ = nullptr;
+	this->ring_ = nullptr;
+	this->batch_ = nullptr;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void IngestingPriorityQueue<Priority, Data, Heap>::clear()
+{
+	this->batch_->clear();
+	this->ring_->drain(*this->batch_);
+	this->batch_->clear();
+	this->priority_queue_->clear();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void IngestingPriorityQueue<Priority, Data, Heap>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	while (!this->ring_->try_push(identifier, priority, data))
+	{
+		std::this_thread::yield();
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline bool IngestingPriorityQueue<Priority, Data, Heap>::try_pop(int& identifier, Data& data)
+{
+	this->drain();
+	if (this->priority_queue_->size() == 0)
+	{
+		return false;
+	}
+	data = this->priority_queue_->pop(identifier);
+	return true;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Heap>
+inline void IngestingPriorityQueue<Priority, Data, Heap>::drain()
+{
+	this->batch_->clear();
+	if (this->ring_->drain(*this->batch_) > 0)
+	{
+		this->priority_queue_->push_batch(*this->batch_);
+	}
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <functional>
+#include <unordered_map>
+
+/// <summary>
+/// Zsobnk uvonench blokov pamte rozdelench do tried poda vekosti, patr kontajneru, ktor ho vytvoril
+/// Uvonen blok sa nevracia aloktoru, ale pouije sa pri alej alokcii rovnakej triedy, preto po zahriat nie s potrebn alokcie
+/// </summary>
+class ItemPool
+{
+private:
+	/// <summary>
+	/// Uvonen blok pamte, ktor ukazuje na al uvonen blok rovnakej triedy
+	/// </summary>
+	struct FreeBlock
+	{
+		FreeBlock* next_;
+	};
+	/// <summary>
+	/// Rozdiel vekost susednch tried blokov
+	/// </summary>
+	static const size_t GRANULARITY = 16;
+	/// <summary>
+	/// Poet tried blokov, vie bloky sa alokuj priamo
+	/// </summary>
+	static const size_t CLASS_COUNT = 16;
+	/// <summary>
+	/// Zoznamy uvonench blokov jednotlivch tried
+	/// </summary>
+	FreeBlock* free_blocks_[CLASS_COUNT];
+	/// <summary>
+	/// Vrti triedu bloku vekosti size
+	/// </summary>
+	/// <param name="size">Vekos bloku</param>
+	/// <returns>Index triedy, CLASS_COUNT ak je blok prli vek</returns>
+	static size_t size_class(const size_t size);
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	ItemPool();
+	/// <summary>
+	/// Detruktor, vrti uvonen bloky aloktoru
+	/// </summary>
+	~ItemPool();
+	/// <summary>
+	/// Vrti blok pamte vekosti aspo size, ak je to mon, pouije uvonen blok
+	/// </summary>
+	/// <param name="size">Vekos bloku</param>
+	/// <returns>Blok pamte</returns>
+	void* allocate(const size_t size);
+	/// <summary>
+	/// Uvon blok pamte vekosti size do zsobnka
+	/// </summary>
+	/// <param name="block">Blok pamte</param>
+	/// <param name="size">Vekos, s ktorou bol blok alokovan</param>
+	void deallocate(void* block, const size_t size);
+};
+
+/// <summary>
+/// Aloktor pre kontajnery tandardnej kninice, ktor berie pam zo zsobnka kontajnera
+/// Zsobnk nie je synchronizovan, kontajner sa smie pouva len z jednho vlkna naraz
+/// </summary>
+/// <typeparam name="T">Dtov typ prvkov</typeparam>
+template <typename T>
+class PoolAllocator
+{
+private:
+	template <typename U>
+	friend class PoolAllocator;
+	/// <summary>
+	/// Zsobnk, z ktorho sa berie pam
+	/// </summary>
+	ItemPool* pool_;
+public:
+	typedef T value_type;
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="pool">Zsobnk, mus existova dlhie ako kontajner</param>
+	PoolAllocator(ItemPool* pool) : pool_(pool) {}
+	/// <summary>
+	/// Kontruktor z aloktora inho typu
+	/// </summary>
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U>& other) : pool_(other.pool_) {}
+	/// <summary>
+	/// Alokuje pam pre count prvkov
+	/// </summary>
+	/// <param name="count">Poet prvkov</param>
+	/// <returns>Smernk na pam</returns>
+	T* allocate(const size_t count) { return (T*)this->pool_->allocate(count * sizeof(T)); }
+	/// <summary>
+	/// Uvon pam pre count prvkov
+	/// </summary>
+	/// <param name="block">Smernk na pam</param>
+	/// <param name="count">Poet prvkov</param>
+	void deallocate(T* block, const size_t count) { this->pool_->deallocate(block, count * sizeof(T)); }
+	template <typename U>
+	bool operator==(const PoolAllocator<U>& other) const { return this->pool_ == other.pool_; }
+	template <typename U>
+	bool operator!=(const PoolAllocator<U>& other) const { return this->pool_ != other.pool_; }
+};
+
+/// <summary>
+/// Haovacia tabuka, ktorej uzly sa ber zo zsobnka predanho v aloktore
+/// </summary>
+/// <typeparam name="Key">Dtov typ ka</typeparam>
+/// <typeparam name="Value">Dtov typ hodnoty</typeparam>
+template <typename Key, typename Value>
+using PooledMap = std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>, PoolAllocator<std::pair<const Key, Value>>>;
+
+inline ItemPool::ItemPool()
+{
+	for (size_t i = 0; i < CLASS_COUNT; i++)
+	{
+		this->free_blocks_[i] = nullptr;
+	}
+}
+
+inline ItemPool::~ItemPool()
+{
+	for (size_t i = 0; i < CLASS_COUNT; i++)
+	{
+		while (this->free_blocks_[i])
+		{
+			FreeBlock* block = this->free_blocks_[i];
+			this->free_blocks_[i] = block->next_;
+			::operator delete(block);
+		}
+	}
+}
+
+inline size_t ItemPool::size_class(const size_t size)
+{
+	size_t index = size ? (size - 1) / GRANULARITY : 0;
+	return index < CLASS_COUNT ? index : CLASS_COUNT;
+}
+
+inline void* ItemPool::allocate(const size_t size)
+{
+	size_t index = size_class(size);
+	if (index == CLASS_COUNT)
+	{
+		return ::operator new(size);
+	}
+	FreeBlock* block = this->free_blocks_[index];
+	if (!block)
+	{
+		return ::operator new((index + 1) * GRANULARITY);
+	}
+	this->free_blocks_[index] = block->next_;
+	return block;
+}
+
+inline void ItemPool::deallocate(void* block, const size_t size)
+{
+	size_t index = size_class(size);
+	if (index == CLASS_COUNT)
+	{
+		::operator delete(block);
+		return;
+	}
+	FreeBlock* free_block = (FreeBlock*)block;
+	free_block->next_ = this->free_blocks_[index];
+	this->free_blocks_[index] = free_block;
+}
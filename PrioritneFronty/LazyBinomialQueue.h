@@ -1,5 +1,21 @@
 #pragma once
 #include "ExplicitPriorityQueue.h"
+#include "SimdMinimum.h"
+
+/// <summary>
+/// Stratgia zluovania stromov v zozname koreov
+/// </summary>
+enum class ConsolidationStrategy
+{
+	/// <summary>
+	/// Kad dvojica stromov rovnakho stupa sa zli najviac raz
+	/// </summary>
+	ONE_PASS,
+	/// <summary>
+	/// Stromy sa zluuj, km v zozname koreov existuj dva stromy rovnakho stupa
+	/// </summary>
+	MULTI_PASS
+};
 
 /// <summary>
 /// Abstraktn predok pre prioritn fronty implementovan lesom binrnych stromov
@@ -10,6 +26,67 @@ template <typename Priority, typename Data>
 class LazyBinomialHeap : public ExplicitPriorityQueue<Priority, Data>
 {
 protected:
+	/// <summary>
+	/// Prznak, e root_ po znen jeho priority nemus by prvkom s najvyou prioritou, minimum sa njde a pri najbliom zluovan
+	/// </summary>
+	bool root_dirty_;
+	/// <summary>
+	/// Poet koreov v zozname koreov, udriavan pri pridvan koreov a pri zluovan
+	/// </summary>
+	size_t root_count_;
+	/// <summary>
+	/// Pole stromov indexovan stupom, ktor sa pouva pri kadom sekvennom zluovan, aby sa nealokovalo znova
+	/// </summary>
+	std::vector<BinaryTreeItem<Priority, Data>*>* node_list_;
+	/// <summary>
+	/// Stromy, ktor pri sekvennom zluovan jednoprechodovou stratgiou vznikli zlenm
+	/// </summary>
+	std::vector<BinaryTreeItem<Priority, Data>*>* merged_list_;
+	/// <summary>
+	/// Najmen poet stromov, od ktorho sa minimum had vektorovmi intrukciami nad poom kov
+	/// </summary>
+	static const size_t SIMD_SCAN_SIZE = 8;
+	/// <summary>
+	/// Ke stromov, v ktorch sa had minimum, pouvaj sa pri kadom hadan, aby sa nealokovali znova
+	/// </summary>
+	std::vector<long long>* tree_keys_;
+	/// <summary>
+	/// Potomkovia prvku, medzi ktormi sa had potomok s najvyou prioritou
+	/// </summary>
+	std::vector<BinaryTreeItem<Priority, Data>*>* sons_;
+	/// <summary>
+	/// Sada intrukci pouit pri hadan minima
+	/// </summary>
+	SimdLevel simd_level_;
+	/// <summary>
+	/// Vrti k prvku zloen z priority a identifiktora, ak ho priorita umouje, inak 0
+	/// </summary>
+	/// <param name="node">Prvok</param>
+	/// <returns>K prvku</returns>
+	static long long tree_key(BinaryTreeItem<Priority, Data>* node);
+	/// <summary>
+	/// Vrti index stromu s najvyou prioritou v neprzdnom zozname trees, pri celoselnej priorite a aspo SIMD_SCAN_SIZE stromoch
+	/// zape ke koreov do svislho poa a minimum njde vektorovmi intrukciami
+	/// </summary>
+	/// <param name="trees">Stromy</param>
+	/// <returns>Index stromu s najvyou prioritou</returns>
+	size_t find_min_tree(std::vector<BinaryTreeItem<Priority, Data>*>& trees);
+	/// <summary>
+	/// Pripoj stromy k zoznamu koreov bez porovnvania a root_ nastav poda stromu s najvyou prioritou
+	/// </summary>
+	/// <param name="trees">Pripjan stromy</param>
+	void add_root_items(std::vector<BinaryTreeItem<Priority, Data>*>& trees);
+	/// <summary>
+	/// Vrti potomka prvku s vyou prioritou ako prvok, ak ich je viac, ten s najvyou prioritou
+	/// Potomkov prvku so stupom aspo SIMD_SCAN_SIZE porovn cez pole kov, uie prvky prejde po smernkoch
+	/// </summary>
+	/// <param name="node">Prvok</param>
+	/// <returns>Potomok s najvyou prioritou, nullptr ak iadny potomok nem vyiu prioritu</returns>
+	BinaryTreeItem<Priority, Data>* highest_priority_son(BinaryTreeItem<Priority, Data>* node);
+	/// <summary>
+	/// Ak root_ nemus by prvkom s najvyou prioritou, zli zoznam koreov, m minimum njde
+	/// </summary>
+	void repair_root();
 	/// <summary>
 	/// Pripoj prvok k atribtu root_ a zvsi poet prvkov
 	/// </summary>
@@ -38,6 +115,53 @@ protected:
 	/// <param name="array_size">Vekos poa v ktorom sa bude zluova</param>
 	void consolidate_root_using_onepass(BinaryTreeItem<Priority, Data>* node, size_t array_size);
 	/// <summary>
+	/// Zli prvky v pravej chrbtici atribtu root_ a parametra node jednm vlknom
+	/// </summary>
+	/// <param name="node">Prv prvok v postupnosti prvkov, ktor sa maj zli</param>
+	/// <param name="array_size">Poiaton vekos poa v ktorom sa bude zluova</param>
+	/// <param name="strategy">Stratgia zluovania stromov</param>
+	void consolidate_root_sequentially(BinaryTreeItem<Priority, Data>* node, size_t array_size, ConsolidationStrategy strategy);
+	/// <summary>
+	/// Zli prvky v pravej chrbtici atribtu root_ a parametra node paralelne
+	/// Zoznam koreov sa rozdel medzi vlkna, kad zli svoju as do vlastnho poa a polia sa nakoniec zlia poda stupa
+	/// </summary>
+	/// <param name="node">Prv prvok v postupnosti prvkov, ktor sa maj zli</param>
+	/// <param name="array_size">Vekos poa v ktorom sa bude zluova</param>
+	/// <param name="strategy">Stratgia zluovania stromov</param>
+	/// <param name="thread_count">Poet vlkien</param>
+	void consolidate_root_in_parallel(BinaryTreeItem<Priority, Data>* node, size_t array_size, ConsolidationStrategy strategy, size_t thread_count);
+	/// <summary>
+	/// Vrti poet vlkien pre zlenie zoznamu koreov, 1 ak sa m zluova sekvenne
+	/// </summary>
+	/// <returns>Poet vlkien</returns>
+	size_t consolidation_thread_count() const;
+	/// <summary>
+	/// Zarad strom do poa stromov poda jeho stupa zvolenou stratgiou
+	/// Ak stupe stromu presiahne vekos poa, pole sa zv
+	/// </summary>
+	/// <param name="node">Kore zaraovanho stromu</param>
+	/// <param name="node_list">Pole stromov indexovan stupom</param>
+	/// <param name="merged_list">Stromy, ktor pri jednoprechodovej stratgii vznikli zlenm a alej sa nezluuj</param>
+	/// <param name="strategy">Stratgia zluovania stromov</param>
+	static void link_tree(BinaryTreeItem<Priority, Data>* node, std::vector<BinaryTreeItem<Priority, Data>*>& node_list,
+		std::vector<BinaryTreeItem<Priority, Data>*>& merged_list, ConsolidationStrategy strategy);
+	/// <summary>
+	/// Presunie stromy zo zoznamu koreov do poa trees a vyprzdni atribt root_
+	/// </summary>
+	/// <param name="trees">Pole koreov stromov</param>
+	void detach_root_list(std::vector<BinaryTreeItem<Priority, Data>*>& trees);
+	/// <summary>
+	/// Vrti stromy z poa trees do zoznamu koreov, zli ich a pole vyprzdni
+	/// </summary>
+	/// <param name="trees">Pole koreov stromov</param>
+	void attach_root_list(std::vector<BinaryTreeItem<Priority, Data>*>& trees);
+	/// <summary>
+	/// Odstrni kore node zo zoznamu koreov, jeho potomkov zli s ostatnmi koremi a zni poet prvkov
+	/// Prvok node sa doasne stane atribtom root_, aby ho zluovanie vynechalo, a nezru sa
+	/// </summary>
+	/// <param name="node">Odstraovan kore</param>
+	void remove_root(BinaryTreeItem<Priority, Data>* node);
+	/// <summary>
 	/// Kontruktor
 	/// </summary>
 	LazyBinomialHeap();
@@ -69,34 +193,77 @@ public:
 	/// </summary>
 	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
 	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps spojenm ich zoznamov koreov
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps) override;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu najviac count prvkov s najvou prioritou
+	/// Synovia vybranch prvkov sa len pridaj k odpojenm koreom a minimum sa had prehadanm koreov,
+	/// korene sa zlia a na konci alebo ke ich poet prekro nsobok logaritmu potu prvkov
+	/// </summary>
+	/// <param name="count">Najv poet vybranch prvkov</param>
+	/// <param name="out">Identifiktory a dta vybranch prvkov</param>
+	/// <returns>Poet vybranch prvkov</returns>
+	size_t pop_n(const size_t count, std::vector<std::pair<int, Data>>& out) override;
 };
 
 template<typename Priority, typename Data>
 inline void LazyBinomialHeap<Priority, Data>::consolidate_root_using_multipass(BinaryTreeItem<Priority, Data>* node, size_t array_size)
 {
-	std::vector<BinaryTreeItem<Priority, Data>*> node_list(array_size);
-	size_t node_degree;
+	size_t thread_count = this->consolidation_thread_count();
+	if (thread_count > 1)
+	{
+		this->consolidate_root_in_parallel(node, array_size, ConsolidationStrategy::MULTI_PASS, thread_count);
+	}
+	else
+	{
+		this->consolidate_root_sequentially(node, array_size, ConsolidationStrategy::MULTI_PASS);
+	}
+}
 
-	if (node)
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::consolidate_root_using_onepass(BinaryTreeItem<Priority, Data>* node, size_t array_size)
+{
+	size_t thread_count = this->consolidation_thread_count();
+	if (thread_count > 1)
 	{
-		for (BinaryTreeItem<Priority, Data>* node_ptr = node, *node_next_ptr = node_ptr->right_son(); node_ptr;
-			node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
-		{
-			node_ptr->cut();
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
+		this->consolidate_root_in_parallel(node, array_size, ConsolidationStrategy::ONE_PASS, thread_count);
+	}
+	else
+	{
+		this->consolidate_root_sequentially(node, array_size, ConsolidationStrategy::ONE_PASS);
+	}
+}
 
-			while (node_list[node_degree])
-			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree++] = nullptr;
-			}
-			node_list[node_degree] = node_ptr;
-		}
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::consolidate_root_sequentially(BinaryTreeItem<Priority, Data>* node, size_t array_size, ConsolidationStrategy strategy)
+{
+	std::vector<BinaryTreeItem<Priority, Data>*>& node_list = *this->node_list_, & merged_list = *this->merged_list_;
+	node_list.assign(array_size, nullptr);
+	merged_list.clear();
+	this->root_dirty_ = false;
+
+	for (BinaryTreeItem<Priority, Data>* node_ptr = node, *node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr; node_ptr;
+		node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
+	{
+		node_ptr->cut();
+		link_tree(node_ptr, node_list, merged_list, strategy);
 	}
 
 	if (this->root_)
 	{
-		int size = this->size_;
 		BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son();
 		this->root_->right_son() = nullptr;
 
@@ -104,124 +271,153 @@ inline void LazyBinomialHeap<Priority, Data>::consolidate_root_using_multipass(B
 			node_ptr = node_next_ptr, node_next_ptr = node_ptr->right_son())
 		{
 			node_ptr->right_son() = nullptr;
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
-
-			while (node_list[node_degree])
-			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree++] = nullptr;
-			}
-			node_list[node_degree] = node_ptr;
+			link_tree(node_ptr, node_list, merged_list, strategy);
 		}
 
 		if (!this->root_->parent())
 		{
-			node_ptr = this->root_;
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
-
-			while (node_list[node_degree])
-			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree++] = nullptr;
-			}
-			node_list[node_degree] = node_ptr;
+			link_tree(this->root_, node_list, merged_list, strategy);
 		}
 
 		this->root_ = nullptr;
 	}
+	this->root_count_ = 0;
 
-	for (BinaryTreeItem<Priority, Data>* node : node_list)
+	for (BinaryTreeItem<Priority, Data>* tree : node_list)
 	{
-		if (node)
+		if (tree)
 		{
-			this->add_root_item(node);
+			merged_list.push_back(tree);
 		}
 	}
+	this->add_root_items(merged_list);
 }
 
 template<typename Priority, typename Data>
-inline void LazyBinomialHeap<Priority, Data>::consolidate_root_using_onepass(BinaryTreeItem<Priority, Data>* node, size_t array_size)
+inline size_t LazyBinomialHeap<Priority, Data>::consolidation_thread_count() const
 {
-	std::vector<BinaryTreeItem<Priority, Data>*> node_list(array_size);
-	BinaryTreeItem<Priority, Data>* root = this->root_;
-	size_t node_degree;
-	this->root_ = nullptr;
+	if (!this->root_ || this->size_ < 2 * PriorityQueue<Priority, Data>::PARALLEL_BATCH_SIZE)
+	{
+		return 1;
+	}
+	return PriorityQueue<Priority, Data>::batch_thread_count(this->root_count_);
+}
 
-	if (node)
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::link_tree(BinaryTreeItem<Priority, Data>* node, std::vector<BinaryTreeItem<Priority, Data>*>& node_list,
+	std::vector<BinaryTreeItem<Priority, Data>*>& merged_list, ConsolidationStrategy strategy)
+{
+	size_t node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node)->degree();
+
+	if (strategy == ConsolidationStrategy::MULTI_PASS)
 	{
-		for (BinaryTreeItem<Priority, Data>* node_ptr = node, *node_next_ptr = node_ptr->right_son(); node_ptr;
-			node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
+		while (node_degree < node_list.size() && node_list[node_degree])
 		{
-			node_ptr->cut();
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
-
-			if (node_list[node_degree])
-			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree] = nullptr;
-				this->add_root_item(node_ptr);
-			}
-			else
-			{
-				node_list[node_degree] = node_ptr;
-			}
+			node = node->merge(node_list[node_degree]);
+			node_list[node_degree++] = nullptr;
 		}
 	}
+	if (node_degree >= node_list.size())
+	{
+		node_list.resize(node_degree + 1);
+	}
 
-	if (root)
+	if (strategy == ConsolidationStrategy::MULTI_PASS)
+	{
+		node_list[node_degree] = node;
+	}
+	else if (node_list[node_degree])
+	{
+		merged_list.push_back(node->merge(node_list[node_degree]));
+		node_list[node_degree] = nullptr;
+	}
+	else
 	{
-		BinaryTreeItem<Priority, Data>* node_ptr = root->right_son();
-		root->right_son() = nullptr;
+		node_list[node_degree] = node;
+	}
+}
 
-		for (BinaryTreeItem<Priority, Data>* node_next_ptr = node_ptr->right_son(); node_ptr != root;
-			node_ptr = node_next_ptr, node_next_ptr = node_ptr->right_son())
-		{
-			node_ptr->right_son() = nullptr;
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::consolidate_root_in_parallel(BinaryTreeItem<Priority, Data>* node, size_t array_size, ConsolidationStrategy strategy, size_t thread_count)
+{
+	std::vector<BinaryTreeItem<Priority, Data>*> trees;
+	this->root_dirty_ = false;
 
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
+	for (BinaryTreeItem<Priority, Data>* node_ptr = node, *node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr; node_ptr;
+		node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
+	{
+		node_ptr->cut();
+		trees.push_back(node_ptr);
+	}
 
-			if (node_list[node_degree])
-			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree] = nullptr;
-				this->add_root_item(node_ptr);
-			}
-			else
-			{
-				node_list[node_degree] = node_ptr;
-			}
-		}
+	BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son();
+	this->root_->right_son() = nullptr;
+	for (BinaryTreeItem<Priority, Data>* node_next_ptr = node_ptr->right_son(); node_ptr != this->root_;
+		node_ptr = node_next_ptr, node_next_ptr = node_ptr->right_son())
+	{
+		node_ptr->right_son() = nullptr;
+		trees.push_back(node_ptr);
+	}
+	if (!this->root_->parent())
+	{
+		trees.push_back(this->root_);
+	}
+	this->root_ = nullptr;
+	this->root_count_ = 0;
 
-		if (!root->parent())
+	std::vector<std::vector<BinaryTreeItem<Priority, Data>*>> node_lists(thread_count, std::vector<BinaryTreeItem<Priority, Data>*>(array_size));
+	std::vector<std::vector<BinaryTreeItem<Priority, Data>*>> merged_lists(thread_count);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		threads.emplace_back([&trees, &node_lists, &merged_lists, strategy, thread_count, t]()
 		{
-			node_ptr = root;
-			node_degree = ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr)->degree();
-
-			if (node_list[node_degree])
+			for (size_t i = trees.size() * t / thread_count; i < trees.size() * (t + 1) / thread_count; i++)
 			{
-				node_ptr = node_ptr->merge(node_list[node_degree]);
-				node_list[node_degree] = nullptr;
-				this->add_root_item(node_ptr);
+				link_tree(trees[i], node_lists[t], merged_lists[t], strategy);
 			}
-			else
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	std::vector<BinaryTreeItem<Priority, Data>*> node_list(array_size);
+	std::vector<BinaryTreeItem<Priority, Data>*> merged_list;
+	for (std::vector<BinaryTreeItem<Priority, Data>*>& thread_node_list : node_lists)
+	{
+		for (BinaryTreeItem<Priority, Data>* tree : thread_node_list)
+		{
+			if (tree)
 			{
-				node_list[node_degree] = node_ptr;
+				link_tree(tree, node_list, merged_list, strategy);
 			}
 		}
 	}
 
-	for (BinaryTreeItem<Priority, Data>* node : node_list)
+	for (std::vector<BinaryTreeItem<Priority, Data>*>& thread_merged_list : merged_lists)
 	{
-		if (node)
+		merged_list.insert(merged_list.end(), thread_merged_list.begin(), thread_merged_list.end());
+	}
+	for (BinaryTreeItem<Priority, Data>* tree : node_list)
+	{
+		if (tree)
 		{
-			this->add_root_item(node);
+			merged_list.push_back(tree);
 		}
 	}
+	this->add_root_items(merged_list);
 }
 
 template<typename Priority, typename Data>
 inline LazyBinomialHeap<Priority, Data>::LazyBinomialHeap() :
-	ExplicitPriorityQueue<Priority, Data>()
+	ExplicitPriorityQueue<Priority, Data>(), root_dirty_(false), root_count_(0),
+	node_list_(new std::vector<BinaryTreeItem<Priority, Data>*>()),
+	merged_list_(new std::vector<BinaryTreeItem<Priority, Data>*>()),
+	tree_keys_(new std::vector<long long>()),
+	sons_(new std::vector<BinaryTreeItem<Priority, Data>*>()),
+	simd_level_(SimdMinimum::supported_level())
 {
 }
 
@@ -229,6 +425,14 @@ template<typename Priority, typename Data>
 inline LazyBinomialHeap<Priority, Data>::~LazyBinomialHeap()
 {
 	this->clear();
+	delete this->node_list_;
+	delete this->merged_list_;
+	delete this->tree_keys_;
+	delete this->sons_;
+	this->node_list_ = nullptr;
+	this->merged_list_ = nullptr;
+	this->tree_keys_ = nullptr;
+	this->sons_ = nullptr;
 }
 
 template<typename Priority, typename Data>
@@ -241,6 +445,8 @@ inline void LazyBinomialHeap<Priority, Data>::clear()
 		delete root;
 	}
 	this->root_ = nullptr;
+	this->root_dirty_ = false;
+	this->root_count_ = 0;
 	this->size_ = 0;
 }
 
@@ -277,6 +483,109 @@ inline void LazyBinomialHeap<Priority, Data>::add_root_item(BinaryTreeItem<Prior
 		this->root_ = node;
 		this->root_->right_son() = this->root_;
 	}
+	this->root_count_++;
+}
+
+template<typename Priority, typename Data>
+inline long long LazyBinomialHeap<Priority, Data>::tree_key(BinaryTreeItem<Priority, Data>* node)
+{
+	if constexpr (SimdMinimum::has_key<Priority>())
+	{
+		return SimdMinimum::key(node->priority(), node->identifier());
+	}
+	return 0;
+}
+
+template<typename Priority, typename Data>
+inline size_t LazyBinomialHeap<Priority, Data>::find_min_tree(std::vector<BinaryTreeItem<Priority, Data>*>& trees)
+{
+	if (SimdMinimum::has_key<Priority>() && trees.size() >= SIMD_SCAN_SIZE)
+	{
+		std::vector<long long>& keys = *this->tree_keys_;
+		keys.resize(trees.size());
+		for (size_t i = 0; i < trees.size(); i++)
+		{
+			keys[i] = tree_key(trees[i]);
+		}
+		return SimdMinimum::find_min(keys.data(), (int)keys.size(), this->simd_level_);
+	}
+	size_t min_index = 0;
+	for (size_t i = 1; i < trees.size(); i++)
+	{
+		if (*trees[i] < *trees[min_index])
+		{
+			min_index = i;
+		}
+	}
+	return min_index;
+}
+
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::add_root_items(std::vector<BinaryTreeItem<Priority, Data>*>& trees)
+{
+	if (trees.empty())
+	{
+		return;
+	}
+	bool keyed = SimdMinimum::has_key<Priority>() && trees.size() >= SIMD_SCAN_SIZE;
+	std::vector<long long>& keys = *this->tree_keys_;
+	keys.resize(keyed ? trees.size() : 0);
+	BinaryTreeItem<Priority, Data>* min_tree = trees[0];
+	for (size_t i = 0; i < trees.size(); i++)
+	{
+		BinaryTreeItem<Priority, Data>* tree = trees[i];
+		if (this->root_)
+		{
+			tree->right_son() = this->root_->right_son();
+			this->root_->right_son() = tree;
+		}
+		else
+		{
+			this->root_ = tree;
+			this->root_->right_son() = this->root_;
+		}
+		if (keyed)
+		{
+			keys[i] = tree_key(tree);
+		}
+		else if (*tree < *min_tree)
+		{
+			min_tree = tree;
+		}
+	}
+	if (keyed)
+	{
+		min_tree = trees[SimdMinimum::find_min(keys.data(), (int)keys.size(), this->simd_level_)];
+	}
+	if (*min_tree < *this->root_)
+	{
+		this->root_ = min_tree;
+	}
+	this->root_count_ += trees.size();
+}
+
+template<typename Priority, typename Data>
+inline BinaryTreeItem<Priority, Data>* LazyBinomialHeap<Priority, Data>::highest_priority_son(BinaryTreeItem<Priority, Data>* node)
+{
+	if ((size_t)((DegreeBinaryTreeItem<Priority, Data>*)node)->degree() < SIMD_SCAN_SIZE)
+	{
+		return node->highest_priority_son();
+	}
+	std::vector<BinaryTreeItem<Priority, Data>*>& sons = *this->sons_;
+	std::vector<long long>& keys = *this->tree_keys_;
+	sons.clear();
+	keys.clear();
+	for (BinaryTreeItem<Priority, Data>* node_ptr = node->left_son(); node_ptr; node_ptr = node_ptr->right_son())
+	{
+		sons.push_back(node_ptr);
+		keys.push_back(tree_key(node_ptr));
+	}
+	if (sons.empty())
+	{
+		return nullptr;
+	}
+	BinaryTreeItem<Priority, Data>* son = sons[SimdMinimum::find_min(keys.data(), (int)keys.size(), this->simd_level_)];
+	return *son < *node ? son : nullptr;
 }
 
 template<typename Priority, typename Data>
@@ -284,6 +593,7 @@ inline Data LazyBinomialHeap<Priority, Data>::pop(int& identifier)
 {
 	if (this->root_)
 	{
+		this->repair_root();
 		BinaryTreeItem<Priority, Data>* root = this->root_;
 		this->root_->parent() = this->root_;
 		this->consolidate_root(root->left_son());
@@ -291,21 +601,139 @@ inline Data LazyBinomialHeap<Priority, Data>::pop(int& identifier)
 		this->size_--;
 		Data data = root->data();
 		identifier = root->identifier();
-		delete root;
+		this->destroy_item(root);
 		return data;
 	}
 	throw new std::out_of_range("LazyBinomialHeap<Priority, Data>::pop(): Priority queue is empty!");
 }
 
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::repair_root()
+{
+	if (this->root_dirty_)
+	{
+		this->consolidate_root(nullptr);
+	}
+}
+
+template<typename Priority, typename Data>
+inline Data& LazyBinomialHeap<Priority, Data>::find_min()
+{
+	this->repair_root();
+	return this->ExplicitPriorityQueue<Priority, Data>::find_min();
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* LazyBinomialHeap<Priority, Data>::find_min_item()
+{
+	this->repair_root();
+	return this->ExplicitPriorityQueue<Priority, Data>::find_min_item();
+}
+
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::remove_root(BinaryTreeItem<Priority, Data>* node)
+{
+	this->root_ = node;
+	this->root_->parent() = this->root_;
+	this->consolidate_root(node->left_son());
+	node->left_son(nullptr);
+	this->size_--;
+}
+
+template<typename Priority, typename Data>
+inline size_t LazyBinomialHeap<Priority, Data>::pop_n(const size_t count, std::vector<std::pair<int, Data>>& out)
+{
+	size_t popped = 0, tree_limit = 8;
+	for (size_t i = this->size_; i > 1; i >>= 1)
+	{
+		tree_limit += 4;
+	}
+	std::vector<BinaryTreeItem<Priority, Data>*> trees;
+	this->detach_root_list(trees);
+	for (; popped < count && !trees.empty(); popped++)
+	{
+		size_t min_index = this->find_min_tree(trees);
+		BinaryTreeItem<Priority, Data>* root = trees[min_index];
+		trees[min_index] = trees.back();
+		trees.pop_back();
+		for (BinaryTreeItem<Priority, Data>* node_ptr = root->left_son(), *node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr; node_ptr;
+			node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
+		{
+			trees.push_back(node_ptr->cut());
+		}
+		root->left_son(nullptr);
+		this->size_--;
+		out.emplace_back(root->identifier(), root->data());
+		this->destroy_item(root);
+		if (trees.size() > tree_limit && popped + 1 < count)
+		{
+			this->attach_root_list(trees);
+			this->detach_root_list(trees);
+		}
+	}
+	this->attach_root_list(trees);
+	return popped;
+}
+
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::detach_root_list(std::vector<BinaryTreeItem<Priority, Data>*>& trees)
+{
+	if (this->root_)
+	{
+		BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son();
+		this->root_->right_son() = nullptr;
+		for (BinaryTreeItem<Priority, Data>* node_next_ptr = node_ptr->right_son(); node_ptr; node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
+		{
+			node_ptr->right_son() = nullptr;
+			trees.push_back(node_ptr);
+		}
+		this->root_ = nullptr;
+		this->root_dirty_ = false;
+		this->root_count_ = 0;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::attach_root_list(std::vector<BinaryTreeItem<Priority, Data>*>& trees)
+{
+	this->add_root_items(trees);
+	trees.clear();
+	if (this->root_)
+	{
+		this->consolidate_root(nullptr);
+	}
+}
+
 template<typename Priority, typename Data>
 inline void LazyBinomialHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
 {
 	if (other_heap)
 	{
 		LazyBinomialHeap<Priority, Data>* heap = (LazyBinomialHeap<Priority, Data>*)other_heap;
-		this->add_root_item(heap->root_);
+		if (!this->root_)
+		{
+			this->root_ = heap->root_;
+			this->root_dirty_ = heap->root_dirty_;
+			this->root_count_ = heap->root_count_;
+		}
+		else if (heap->root_)
+		{
+			this->add_root_item(heap->root_);
+			this->root_dirty_ = this->root_dirty_ || heap->root_dirty_;
+			this->root_count_ += heap->root_count_ - 1;
+		}
 		this->size_ += heap->size_;
 		heap->root_ = nullptr;
 		delete other_heap;
 	}
 }
+
+template<typename Priority, typename Data>
+inline void LazyBinomialHeap<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	for (PriorityQueue<Priority, Data>* heap : heaps)
+	{
+		this->LazyBinomialHeap<Priority, Data>::merge(heap);
+	}
+	heaps.clear();
+}
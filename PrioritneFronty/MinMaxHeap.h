@@ -0,0 +1,484 @@
+#pragma once
+#include "PriorityQueue.h"
+#include <vector>
+
+/// <summary>
+/// Obojstrann prioritn front implementovan min-max haldou v implicitnom zozname
+/// Prvky na prnych rovniach s menie ako ich potomkovia, prvky na neprnych rovniach s vie ako ich potomkovia
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class MinMaxHeap : public PriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Implicitn zoznam prvkov
+	/// </summary>
+	std::vector<ArrayItem<Priority, Data>*>* list_;
+	/// <summary>
+	/// Maximlny poet prvkov, 0 ak je kapacita neobmedzen
+	/// </summary>
+	size_t capacity_;
+	/// <summary>
+	/// Vrti index priameho predka prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index priameho predka</returns>
+	static int parent(const int index);
+	/// <summary>
+	/// Vrti, i sa index nachdza na rovni s minimami
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>True, ak je rove indexu prna</returns>
+	static bool is_min_level(const int index);
+	/// <summary>
+	/// Vrti, i m by prvok item_1 bliie ku koreu ako prvok item_2
+	/// </summary>
+	/// <param name="item_1">Prv prvok</param>
+	/// <param name="item_2">Druh prvok</param>
+	/// <param name="max_level">True, ak sa porovnva na rovni s maximami</param>
+	/// <returns>True, ak item_1 predchdza item_2</returns>
+	static bool precedes(ArrayItem<Priority, Data>* item_1, ArrayItem<Priority, Data>* item_2, const bool max_level);
+	/// <summary>
+	/// Vrti index prvku s maximlnou prioritou
+	/// </summary>
+	/// <returns>Index maxima</returns>
+	int max_index();
+	/// <summary>
+	/// Vymiea prvok na indexe index s predkami, dokia nie je splnen haldov usporiadanie
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	void heapify_up(const int index);
+	/// <summary>
+	/// Vymiea prvok na indexe index s prarodimi na rovniach rovnakho typu
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <param name="max_level">True, ak je prvok na rovni s maximami</param>
+	void heapify_up(const int index, const bool max_level);
+	/// <summary>
+	/// Vymiea prvok na indexe index s najmenm, resp. najvm z potomkov a vnukov, dokia nie je splnen haldov usporiadanie
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	void heapify_down(const int index);
+	/// <summary>
+	/// Obnov haldov usporiadanie po zmene prvku na indexe index
+	/// </summary>
+	/// <param name="index">Index zmenenho prvku</param>
+	void restore(const int index);
+	/// <summary>
+	/// Odstrni prvok na indexe index zo zoznamu
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Odstrnen prvok</returns>
+	ArrayItem<Priority, Data>* remove(const int index);
+	/// <summary>
+	/// Vymen prvky uloen v item_1 a item_2
+	/// </summary>
+	/// <param name="item_1"></param>
+	/// <param name="item_2"></param>
+	static void swap(ArrayItem<Priority, Data>*& item_1, ArrayItem<Priority, Data>*& item_2);
+protected:
+	/// <summary>
+	/// Obnov haldov usporiadanie po zven priority prvku
+	/// </summary>
+	/// <param name="node">Prvok so zvenou prioritou</param>
+	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Obnov haldov usporiadanie po znen priority prvku
+	/// </summary>
+	/// <param name="node">Prvok so znenou prioritou</param>
+	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="capacity">Maximlny poet prvkov, pri prekroen sa odstrni prvok s najmenou prioritou, 0 pre neobmedzen kapacitu</param>
+	MinMaxHeap(const size_t capacity = 0);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~MinMaxHeap();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vrti poet prvkov v prioritnom fronte
+	/// </summary>
+	/// <returns>Poet prvkov v prioritnom fronte</returns>
+	size_t size() const override;
+	/// <summary>
+	/// Vrti maximlny poet prvkov
+	/// </summary>
+	/// <returns>Kapacita, 0 ak je neobmedzen</returns>
+	size_t capacity() const;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu, pri plnom fronte vyhod vnimku, lebo volajci by sa o vyradenom prvku nedozvedel
+	/// Obmedzen kapacitu preto nemono pouva cez PriorityQueueWrapper, vyraovanie podporuje push s evicted_identifier
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu, pri plnom fronte z neho vyberie prvok s najmenou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok, nullptr ak bol vyraden prve vkladan prvok</param>
+	/// <param name="evicted_identifier">Identifiktor vyradenho prvku</param>
+	/// <param name="evicted_data">Dta vyradenho prvku</param>
+	/// <returns>True, ak bol nejak prvok vyraden</returns>
+	bool push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item, int& evicted_identifier, Data& evicted_data);
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najmenou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najmenou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop_max(int& identifier);
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
+	/// Vrti dta s najmenou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_max();
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky z other_heap, pri prekroen kapacity zmae prvky s najmenou prioritou
+	/// </summary>
+	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
+	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+};
+
+template<typename Priority, typename Data>
+inline MinMaxHeap<Priority, Data>::MinMaxHeap(const size_t capacity) :
+	PriorityQueue<Priority, Data>(),
+	list_(new std::vector<ArrayItem<Priority, Data>*>()),
+	capacity_(capacity)
+{
+	if (capacity > 0)
+	{
+		this->list_->reserve(capacity);
+	}
+}
+
+template<typename Priority, typename Data>
+inline MinMaxHeap<Priority, Data>::~MinMaxHeap()
+{
+	this->clear();
+	delete this->list_;
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::clear()
+{
+	for (PriorityQueueItem<Priority, Data>* item : *this->list_)
+	{
+		delete item;
+	}
+	this->list_->clear();
+}
+
+template<typename Priority, typename Data>
+inline size_t MinMaxHeap<Priority, Data>::size() const
+{
+	return this->list_->size();
+}
+
+template<typename Priority, typename Data>
+inline size_t MinMaxHeap<Priority, Data>::capacity() const
+{
+	return this->capacity_;
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
+{
+	if (this->capacity_ > 0 && this->size() >= this->capacity_)
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::push(): Front je plny, vyradenie prvku ohlasi len push s evicted_identifier");
+	}
+	int evicted_identifier;
+	Data evicted_data;
+	this->push(identifier, priority, data, data_item, evicted_identifier, evicted_data);
+}
+
+template<typename Priority, typename Data>
+inline bool MinMaxHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item, int& evicted_identifier, Data& evicted_data)
+{
+	ArrayItem<Priority, Data>* new_node = this->template create_item<ArrayItem<Priority, Data>>(identifier, priority, data, this->size());
+	if (this->capacity_ > 0 && this->size() >= this->capacity_ && !(*new_node < *(*this->list_)[this->max_index()]))
+	{
+		evicted_identifier = new_node->identifier();
+		evicted_data = new_node->data();
+		data_item = nullptr;
+		this->destroy_item(new_node);
+		return true;
+	}
+	bool evicted = false;
+	if (this->capacity_ > 0 && this->size() >= this->capacity_)
+	{
+		evicted_data = this->pop_max(evicted_identifier);
+		evicted = true;
+		new_node->index() = this->size();
+	}
+	this->list_->push_back(new_node);
+	this->heapify_up(this->size() - 1);
+	data_item = new_node;
+	return evicted;
+}
+
+template<typename Priority, typename Data>
+inline Data MinMaxHeap<Priority, Data>::pop(int& identifier)
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::pop(): Zoznam je prazdny");
+	}
+	ArrayItem<Priority, Data>* item = this->remove(0);
+	Data data = item->data();
+	identifier = item->identifier();
+	this->destroy_item(item);
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline Data MinMaxHeap<Priority, Data>::pop_max(int& identifier)
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::pop_max(): Zoznam je prazdny");
+	}
+	ArrayItem<Priority, Data>* item = this->remove(this->max_index());
+	Data data = item->data();
+	identifier = item->identifier();
+	this->destroy_item(item);
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	this->destroy_item(this->remove(((ArrayItem<Priority, Data>*)node)->index()));
+}
+
+template<typename Priority, typename Data>
+inline Data& MinMaxHeap<Priority, Data>::find_min()
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::find_min(): Zoznam je prazdny");
+	}
+	return (*this->list_)[0]->data();
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* MinMaxHeap<Priority, Data>::find_min_item()
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::find_min_item(): Zoznam je prazdny");
+	}
+	return (*this->list_)[0];
+}
+
+template<typename Priority, typename Data>
+inline Data& MinMaxHeap<Priority, Data>::find_max()
+{
+	if (this->list_->empty())
+	{
+		throw new std::out_of_range("MinMaxHeap<Priority, Data>::find_max(): Zoznam je prazdny");
+	}
+	return (*this->list_)[this->max_index()]->data();
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
+{
+	MinMaxHeap<Priority, Data>* heap = (MinMaxHeap<Priority, Data>*)other_heap;
+	this->list_->insert(this->list_->end(), heap->list_->begin(), heap->list_->end());
+	heap->list_->clear();
+	for (int i = 0; i < (int)this->size(); i++)
+	{
+		(*this->list_)[i]->index() = i;
+	}
+	for (int i = (int)this->size() / 2 - 1; i >= 0; i--)
+	{
+		this->heapify_down(i);
+	}
+	while (this->capacity_ > 0 && this->size() > this->capacity_)
+	{
+		this->destroy_item(this->remove(this->max_index()));
+	}
+	delete heap;
+}
+
+template<typename Priority, typename Data>
+inline int MinMaxHeap<Priority, Data>::parent(const int index)
+{
+	return (index - 1) / 2;
+}
+
+template<typename Priority, typename Data>
+inline bool MinMaxHeap<Priority, Data>::is_min_level(const int index)
+{
+	int level = 0;
+	for (unsigned int position = (unsigned int)index + 1; position > 1; position >>= 1)
+	{
+		level++;
+	}
+	return level % 2 == 0;
+}
+
+template<typename Priority, typename Data>
+inline bool MinMaxHeap<Priority, Data>::precedes(ArrayItem<Priority, Data>* item_1, ArrayItem<Priority, Data>* item_2, const bool max_level)
+{
+	return max_level ? *item_2 < *item_1 : *item_1 < *item_2;
+}
+
+template<typename Priority, typename Data>
+inline int MinMaxHeap<Priority, Data>::max_index()
+{
+	if (this->size() < 3)
+	{
+		return (int)this->size() - 1;
+	}
+	return *(*this->list_)[2] < *(*this->list_)[1] ? 1 : 2;
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::heapify_up(const int index)
+{
+	if (index == 0)
+	{
+		return;
+	}
+	bool max_level = !is_min_level(index);
+	int parent = MinMaxHeap<Priority, Data>::parent(index);
+	if (precedes((*this->list_)[index], (*this->list_)[parent], !max_level))
+	{
+		swap((*this->list_)[index], (*this->list_)[parent]);
+		this->heapify_up(parent, !max_level);
+	}
+	else
+	{
+		this->heapify_up(index, max_level);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::heapify_up(const int index, const bool max_level)
+{
+	for (int i = index, grandparent = parent(parent(i)); i > 2 && precedes((*this->list_)[i], (*this->list_)[grandparent], max_level); i = grandparent, grandparent = parent(parent(i)))
+	{
+		swap((*this->list_)[grandparent], (*this->list_)[i]);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::heapify_down(const int index)
+{
+	bool max_level = !is_min_level(index);
+	int size = (int)this->size();
+	for (int i = index; 2 * i + 1 < size; )
+	{
+		int first_child = 2 * i + 1, best = first_child;
+		if (first_child + 1 < size && precedes((*this->list_)[first_child + 1], (*this->list_)[best], max_level))
+		{
+			best = first_child + 1;
+		}
+		for (int j = 2 * first_child + 1; j <= 2 * first_child + 4 && j < size; j++)
+		{
+			if (precedes((*this->list_)[j], (*this->list_)[best], max_level))
+			{
+				best = j;
+			}
+		}
+		if (!precedes((*this->list_)[best], (*this->list_)[i], max_level))
+		{
+			break;
+		}
+		swap((*this->list_)[best], (*this->list_)[i]);
+		if (best <= first_child + 1)
+		{
+			break;
+		}
+		int parent = MinMaxHeap<Priority, Data>::parent(best);
+		if (precedes((*this->list_)[parent], (*this->list_)[best], max_level))
+		{
+			swap((*this->list_)[parent], (*this->list_)[best]);
+		}
+		i = best;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::restore(const int index)
+{
+	ArrayItem<Priority, Data>* item = (*this->list_)[index];
+	this->heapify_down(index);
+	this->heapify_up(item->index());
+}
+
+template<typename Priority, typename Data>
+inline ArrayItem<Priority, Data>* MinMaxHeap<Priority, Data>::remove(const int index)
+{
+	if (index != (int)this->size() - 1)
+	{
+		swap((*this->list_)[index], (*this->list_)[this->size() - 1]);
+	}
+	ArrayItem<Priority, Data>* item = this->list_->back();
+	this->list_->pop_back();
+	if (index < (int)this->size())
+	{
+		this->restore(index);
+	}
+	return item;
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::swap(ArrayItem<Priority, Data>*& item_1, ArrayItem<Priority, Data>*& item_2)
+{
+	std::swap(item_1, item_2);
+	std::swap(item_1->index(), item_2->index());
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>* node)
+{
+	this->restore(((ArrayItem<Priority, Data>*)node)->index());
+}
+
+template<typename Priority, typename Data>
+inline void MinMaxHeap<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>* node)
+{
+	this->restore(((ArrayItem<Priority, Data>*)node)->index());
+}
@@ -0,0 +1,326 @@
+#pragma once
+#include "ConcurrentPriorityQueue.h"
+#include "BinaryHeap.h"
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// iastkov front multifrontu chrnen zmkom, ktor zverejuje prioritu svojho minima
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+/// <typeparam name="Shard">Prioritn front pouit ako iastkov front</typeparam>
+template <typename Priority, typename Data, template <typename, typename> class Shard>
+class alignas(64) MultiQueueShard
+{
+private:
+	/// <summary>
+	/// Prioritn front, dta obsahuj aj prioritu, aby bolo mon zisti prioritu minima
+	/// </summary>
+	Shard<Priority, std::pair<Priority, Data>>* queue_;
+	/// <summary>
+	/// Zmok chrniaci prioritn front
+	/// </summary>
+	std::mutex mutex_;
+	/// <summary>
+	/// Priorita minima, platn ak front nie je przdny
+	/// </summary>
+	std::atomic<Priority> top_;
+	/// <summary>
+	/// Prznak przdneho frontu
+	/// </summary>
+	std::atomic<bool> empty_;
+	/// <summary>
+	/// Zverejn prioritu minima po zmene frontu
+	/// </summary>
+	void publish();
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	MultiQueueShard();
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~MultiQueueShard();
+	/// <summary>
+	/// Poksi sa uzamkn front
+	/// </summary>
+	/// <returns>True, ak bol front uzamknut</returns>
+	bool try_lock();
+	/// <summary>
+	/// Uzamkne front
+	/// </summary>
+	void lock();
+	/// <summary>
+	/// Odomkne front
+	/// </summary>
+	void unlock();
+	/// <summary>
+	/// Vrti, i je front przdny, bez uzamknutia
+	/// </summary>
+	/// <returns>True, ak je front przdny</returns>
+	bool empty() const;
+	/// <summary>
+	/// Vrti prioritu minima, bez uzamknutia
+	/// </summary>
+	/// <returns>Priorita minima</returns>
+	Priority top() const;
+	/// <summary>
+	/// Vyme vetky prvky, front mus by uzamknut
+	/// </summary>
+	void clear();
+	/// <summary>
+	/// Vlo dta do frontu, front mus by uzamknut
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data);
+	/// <summary>
+	/// Vyberie z frontu dta s najvou prioritou, front mus by uzamknut a nesmie by przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier);
+};
+
+/// <summary>
+/// Relaxovan sben prioritn front zloen z c * P iastkovch frontov chrnench zmkami
+/// Vklad do nhodnho frontu, vyber z lepieho z dvoch nhodnch frontov, vybran prvky preto nemusia by globlne minim
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+/// <typeparam name="Shard">Prioritn front pouit ako iastkov front</typeparam>
+template <typename Priority, typename Data, template <typename, typename> class Shard = BinaryHeap>
+class MultiQueue : public ConcurrentPriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// iastkov fronty
+	/// </summary>
+	std::vector<MultiQueueShard<Priority, Data, Shard>*>* shards_;
+	/// <summary>
+	/// Priblin poet prvkov vo vetkch frontoch
+	/// </summary>
+	std::atomic<long long> size_;
+	/// <summary>
+	/// Vrti index nhodnho iastkovho frontu
+	/// </summary>
+	/// <returns>Index frontu</returns>
+	size_t random_shard();
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="thread_count">Poet vlkien P, ktor bud k frontu pristupova</param>
+	/// <param name="relaxation_factor">Poet iastkovch frontov na vlkno c, vie c zniuje sperenie o zmky a zvyuje chybu poradia</param>
+	MultiQueue(const int thread_count, const int relaxation_factor = 2);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~MultiQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do nhodnho iastkovho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data) override;
+	/// <summary>
+	/// Vyberie dta z toho z dvoch nhodnch iastkovch frontov, ktorho minimum m viu prioritu
+	/// </summary>
+	/// <param name="identifier">Identifiktor vybranho prvku</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran, false ak s vetky iastkov fronty przdne</returns>
+	bool try_pop(int& identifier, Data& data) override;
+};
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline MultiQueueShard<Priority, Data, Shard>::MultiQueueShard() :
+	queue_(new Shard<Priority, std::pair<Priority, Data>>()),
+	top_(Priority()),
+	empty_(true)
+{
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline MultiQueueShard<Priority, Data, Shard>::~MultiQueueShard()
+{
+	delete this->queue_;
+	this->queue_ = nullptr;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueueShard<Priority, Data, Shard>::publish()
+{
+	if (this->queue_->size() == 0)
+	{
+		this->empty_.store(true, std::memory_order_relaxed);
+	}
+	else
+	{
+		this->top_.store(this->queue_->find_min().first, std::memory_order_relaxed);
+		this->empty_.store(false, std::memory_order_relaxed);
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline bool MultiQueueShard<Priority, Data, Shard>::try_lock()
+{
+	return this->mutex_.try_lock();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueueShard<Priority, Data, Shard>::lock()
+{
+	this->mutex_.lock();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueueShard<Priority, Data, Shard>::unlock()
+{
+	this->mutex_.unlock();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline bool MultiQueueShard<Priority, Data, Shard>::empty() const
+{
+	return this->empty_.load(std::memory_order_relaxed);
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline Priority MultiQueueShard<Priority, Data, Shard>::top() const
+{
+	return this->top_.load(std::memory_order_relaxed);
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueueShard<Priority, Data, Shard>::clear()
+{
+	this->queue_->clear();
+	this->publish();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueueShard<Priority, Data, Shard>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	PriorityQueueItem<Priority, std::pair<Priority, Data>>* priority_queue_item;
+	this->queue_->push(identifier, priority, std::pair<Priority, Data>(priority, data), priority_queue_item);
+	this->publish();
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline Data MultiQueueShard<Priority, Data, Shard>::pop(int& identifier)
+{
+	Data data = this->queue_->pop(identifier).second;
+	this->publish();
+	return data;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline MultiQueue<Priority, Data, Shard>::MultiQueue(const int thread_count, const int relaxation_factor) :
+	ConcurrentPriorityQueue<Priority, Data>(),
+	shards_(new std::vector<MultiQueueShard<Priority, Data, Shard>*>()),
+	size_(0)
+{
+	int shard_count = std::max(thread_count * relaxation_factor, 2);
+	for (int i = 0; i < shard_count; i++)
+	{
+		this->shards_->push_back(new MultiQueueShard<Priority, Data, Shard>());
+	}
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline MultiQueue<Priority, Data, Shard>::~MultiQueue()
+{
+	for (MultiQueueShard<Priority, Data, Shard>* shard : *this->shards_)
+	{
+		delete shard;
+	}
+	delete this->shards_;
+	this->shards_ = nullptr;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueue<Priority, Data, Shard>::clear()
+{
+	for (MultiQueueShard<Priority, Data, Shard>* shard : *this->shards_)
+	{
+		shard->lock();
+		shard->clear();
+		shard->unlock();
+	}
+	this->size_.store(0);
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline void MultiQueue<Priority, Data, Shard>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	MultiQueueShard<Priority, Data, Shard>* shard;
+	do
+	{
+		shard = (*this->shards_)[this->random_shard()];
+	} while (!shard->try_lock());
+	shard->push(identifier, priority, data);
+	shard->unlock();
+	this->size_.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline bool MultiQueue<Priority, Data, Shard>::try_pop(int& identifier, Data& data)
+{
+	for (size_t attempt = 0; attempt < this->shards_->size() && this->size_.load(std::memory_order_relaxed) > 0; attempt++)
+	{
+		MultiQueueShard<Priority, Data, Shard>* shard_1 = (*this->shards_)[this->random_shard()];
+		MultiQueueShard<Priority, Data, Shard>* shard_2 = (*this->shards_)[this->random_shard()];
+		if (shard_1->empty() || (!shard_2->empty() && shard_2->top() < shard_1->top()))
+		{
+			std::swap(shard_1, shard_2);
+		}
+		if (shard_1->empty() || !shard_1->try_lock())
+		{
+			continue;
+		}
+		if (shard_1->empty())
+		{
+			shard_1->unlock();
+			continue;
+		}
+		data = shard_1->pop(identifier);
+		shard_1->unlock();
+		this->size_.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+	for (MultiQueueShard<Priority, Data, Shard>* shard : *this->shards_)
+	{
+		if (shard->empty())
+		{
+			continue;
+		}
+		shard->lock();
+		if (!shard->empty())
+		{
+			data = shard->pop(identifier);
+			shard->unlock();
+			this->size_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		shard->unlock();
+	}
+	return false;
+}
+
+template<typename Priority, typename Data, template <typename, typename> class Shard>
+inline size_t MultiQueue<Priority, Data, Shard>::random_shard()
+{
+	static thread_local std::mt19937 generator(std::random_device{}());
+	return generator() % this->shards_->size();
+}
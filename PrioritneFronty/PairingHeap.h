@@ -1,7 +1,8 @@
 #pragma once
 #include "ExplicitPriorityQueue.h"
+#include "Prefetch.h"
 #include <stack>
-#include <queue>
+#include <vector>
 
 /// <summary>
 /// Abstraktn provacia halda
@@ -56,11 +57,31 @@ public:
 	/// <returns>Hodnota dt</returns>
 	Data pop(int& identifier) override;
 	/// <summary>
+	/// Vystrihne prvok, z jeho potomkov vytvor binrny strom, ktor prepoj s root_, a prvok zru
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
 	/// Zmen prioritu prvku
 	/// </summary>
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps vyvenm zluovanm koreov po dvojiciach
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps) override;
+	/// <summary>
+	/// Vlo do prioritnho frontu dvku prvkov, pri vekej dvke vlkna paralelne spoja svoje asti dvky do stromov, ktor sa zlia s koreom
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	void push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
+	/// Zmen priority dvky prvkov, podstromy prvkov so zvenou prioritou sa vystrihn, spruj medzi sebou a s koreom sa zlia raz
+	/// </summary>
+	/// <param name="operations">Opercie zmeny priority s nastavenmi prvkami</param>
+	void change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
 };
 
 /// <summary>
@@ -73,12 +94,13 @@ class PairingHeapTwoPass : public PairingHeap<Priority, Data>
 {
 private:
 	/// <summary>
-	/// Zsobnk pouit pri zluovan prvkov
+	/// Zsobnk pouit pri zluovan prvkov, je uloen v poli, ktor si ponechva kapacitu medzi zluovaniami
 	/// </summary>
-	std::stack<BinaryTreeItem<Priority, Data>*>* stack_;
+	std::stack<BinaryTreeItem<Priority, Data>*, std::vector<BinaryTreeItem<Priority, Data>*>>* stack_;
 protected:
 	/// <summary>
 	/// Vytvor binrny strom z prvku node a jeho potomkov
+	/// Poas zluovania dvojice prednata druh prvok nasledujcej dvojice, ak je zapnut PRIORITY_QUEUE_PREFETCH
 	/// </summary>
 	/// <param name="node">Prv prvok v postupnosti prvkov, ktor sa maj vytvori binrny strom</param>
 	/// <returns>Prvok tvoriac kore binrneho stromu</returns>
@@ -112,6 +134,11 @@ public:
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->PairingHeap<Priority, Data>::erase(node); };
 };
 
 /// <summary>
@@ -124,12 +151,13 @@ class PairingHeapMultiPass : public PairingHeap<Priority, Data>
 {
 private:
 	/// <summary>
-	/// Front pouit pri zluovan prvkov
+	/// Front pouit pri zluovan prvkov, uloen v poli, z ktorho sa vybran prvky neodstrauj, aby si pole ponechalo kapacitu
 	/// </summary>
-	std::queue<BinaryTreeItem<Priority, Data>*>* queue_;
+	std::vector<BinaryTreeItem<Priority, Data>*>* queue_;
 protected:
 	/// <summary>
 	/// Vytvor binrny strom z prvku node a jeho potomkov
+	/// Poas zluovania dvojice prednata druh prvok nasledujcej dvojice, ak je zapnut PRIORITY_QUEUE_PREFETCH
 	/// </summary>
 	/// <param name="node">Prv prvok v postupnosti prvkov, ktor sa maj vytvori binrny strom</param>
 	/// <returns>Prvok tvoriac kore binrneho stromu</returns>
@@ -163,6 +191,11 @@ public:
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override { this->PairingHeap<Priority, Data>::erase(node); };
 };
 
 template<typename Priority, typename Data>
@@ -220,7 +253,7 @@ inline PairingHeap<Priority, Data>::~PairingHeap()
 template<typename Priority, typename Data>
 inline void PairingHeap<Priority, Data>::push(const int identifier, const Priority& key, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
 {
-	BinaryTreeItem<Priority, Data>* new_node = new BinaryTreeItem<Priority, Data>(identifier, key, data);
+	BinaryTreeItem<Priority, Data>* new_node = this->template create_item<BinaryTreeItem<Priority, Data>>(identifier, key, data);
 	if (this->root_)
 	{
 		this->root_ = this->root_->merge(new_node);
@@ -244,12 +277,30 @@ inline Data PairingHeap<Priority, Data>::pop(int& identifier)
 		this->size_--;
 		Data data = root->data();
 		identifier = root->identifier();
-		delete root;
+		this->destroy_item(root);
 		return data;
 	}
 	throw new std::range_error("PairingHeap<Priority, Data>::pop(): Priority queue is empty!");
 }
 
+template<typename Priority, typename Data>
+inline void PairingHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	BinaryTreeItem<Priority, Data>* node_ptr = (BinaryTreeItem<Priority, Data>*)node;
+	if (node_ptr == this->root_)
+	{
+		this->root_ = this->create_binary_tree(node_ptr->left_son());
+	}
+	else
+	{
+		node_ptr->cut();
+		this->root_ = this->root_->merge(this->create_binary_tree(node_ptr->left_son()));
+	}
+	node_ptr->left_son() = nullptr;
+	this->size_--;
+	this->destroy_item(node_ptr);
+}
+
 template<typename Priority, typename Data>
 inline void PairingHeap<Priority, Data>::clear()
 {
@@ -280,9 +331,136 @@ inline void PairingHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* ot
 	delete heap;
 }
 
+template<typename Priority, typename Data>
+inline void PairingHeap<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	std::vector<BinaryTreeItem<Priority, Data>*> roots;
+	if (this->root_)
+	{
+		roots.push_back(this->root_);
+	}
+	for (PriorityQueue<Priority, Data>* other_heap : heaps)
+	{
+		PairingHeap<Priority, Data>* heap = (PairingHeap<Priority, Data>*)other_heap;
+		if (heap->root_)
+		{
+			roots.push_back(heap->root_);
+			heap->root_ = nullptr;
+		}
+		this->size_ += heap->size_;
+		delete heap;
+	}
+	heaps.clear();
+
+	while (roots.size() > 1)
+	{
+		size_t pair_count = roots.size() / 2;
+		for (size_t i = 0; i < pair_count; i++)
+		{
+			roots[i] = roots[2 * i]->merge(roots[2 * i + 1]);
+		}
+		if (roots.size() % 2)
+		{
+			roots[pair_count++] = roots.back();
+		}
+		roots.resize(pair_count);
+	}
+
+	if (!roots.empty())
+	{
+		this->root_ = roots.front();
+		this->root_->parent() = nullptr;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void PairingHeap<Priority, Data>::push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	size_t thread_count = PriorityQueue<Priority, Data>::batch_thread_count(operations.size());
+	if (thread_count == 1)
+	{
+		this->PriorityQueue<Priority, Data>::push_batch(operations);
+		return;
+	}
+
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		operation.node() = this->template create_item<BinaryTreeItem<Priority, Data>>(operation.identifier(), operation.priority(), operation.data());
+	}
+	std::vector<BinaryTreeItem<Priority, Data>*> roots(thread_count, nullptr);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		threads.emplace_back([&operations, &roots, thread_count, t]()
+		{
+			BinaryTreeItem<Priority, Data>* root = nullptr;
+			for (size_t i = operations.size() * t / thread_count; i < operations.size() * (t + 1) / thread_count; i++)
+			{
+				BinaryTreeItem<Priority, Data>* new_node = (BinaryTreeItem<Priority, Data>*)operations[i].node();
+				root = root ? root->merge(new_node) : new_node;
+			}
+			roots[t] = root;
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (BinaryTreeItem<Priority, Data>* root : roots)
+	{
+		this->root_ = this->root_ ? this->root_->merge(root) : root;
+		this->root_->parent() = nullptr;
+	}
+	this->size_ += operations.size();
+}
+
+template<typename Priority, typename Data>
+inline void PairingHeap<Priority, Data>::change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	std::vector<BinaryTreeItem<Priority, Data>*> cut_nodes;
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		BinaryTreeItem<Priority, Data>* node = (BinaryTreeItem<Priority, Data>*)operation.node();
+		bool is_cut = node != this->root_ && !node->parent();
+		if (operation.priority() < node->priority())
+		{
+			node->priority() = operation.priority();
+			if (node != this->root_ && !is_cut)
+			{
+				cut_nodes.push_back(node->cut());
+			}
+		}
+		else if (is_cut)
+		{
+			node->priority() = operation.priority();
+			BinaryTreeItem<Priority, Data>* sons = node->left_son();
+			node->left_son() = nullptr;
+			if (sons)
+			{
+				cut_nodes.push_back(this->create_binary_tree(sons));
+			}
+		}
+		else
+		{
+			this->PriorityQueue<Priority, Data>::change_priority(node, operation.priority());
+		}
+	}
+
+	if (!cut_nodes.empty())
+	{
+		for (size_t i = 1; i < cut_nodes.size(); i++)
+		{
+			cut_nodes[i - 1]->right_son(cut_nodes[i]);
+		}
+		this->root_ = this->root_->merge(this->create_binary_tree(cut_nodes.front()));
+		this->root_->parent() = nullptr;
+	}
+}
+
 template<typename Priority, typename Data>
 inline PairingHeapTwoPass<Priority, Data>::PairingHeapTwoPass() :
-	PairingHeap<Priority, Data>(), stack_(new std::stack<BinaryTreeItem<Priority, Data>*>())
+	PairingHeap<Priority, Data>(), stack_(new std::stack<BinaryTreeItem<Priority, Data>*, std::vector<BinaryTreeItem<Priority, Data>*>>())
 {
 }
 
@@ -304,6 +482,12 @@ inline BinaryTreeItem<Priority, Data>* PairingHeapTwoPass<Priority, Data>::creat
 			while (node_ptr)
 			{
 				node_next_ptr = node_ptr->right_son() ? node_ptr->right_son()->right_son() : nullptr;
+#if PRIORITY_QUEUE_PREFETCH
+				if (node_next_ptr)
+				{
+					Prefetch::read(node_next_ptr->right_son());
+				}
+#endif
 				node_ptr = node_ptr->merge(node_ptr->right_son());
 				node_ptr->right_son() = nullptr;
 				this->stack_->push(node_ptr);
@@ -324,7 +508,7 @@ inline BinaryTreeItem<Priority, Data>* PairingHeapTwoPass<Priority, Data>::creat
 
 template<typename Priority, typename Data>
 inline PairingHeapMultiPass<Priority, Data>::PairingHeapMultiPass() :
-	PairingHeap<Priority, Data>(), queue_(new std::queue<BinaryTreeItem<Priority, Data>*>())
+	PairingHeap<Priority, Data>(), queue_(new std::vector<BinaryTreeItem<Priority, Data>*>())
 {
 }
 
@@ -338,6 +522,7 @@ template<typename Priority, typename Data>
 inline BinaryTreeItem<Priority, Data>* PairingHeapMultiPass<Priority, Data>::create_binary_tree(BinaryTreeItem<Priority, Data>* node)
 {
 	BinaryTreeItem<Priority, Data>* node_ptr = node, * node_next_ptr;
+	std::vector<BinaryTreeItem<Priority, Data>*>& queue = *this->queue_;
 
 	if (node_ptr)
 	{
@@ -346,21 +531,26 @@ inline BinaryTreeItem<Priority, Data>* PairingHeapMultiPass<Priority, Data>::cre
 			while (node_ptr)
 			{
 				node_next_ptr = node_ptr->right_son() ? node_ptr->right_son()->right_son() : nullptr;
+#if PRIORITY_QUEUE_PREFETCH
+				if (node_next_ptr)
+				{
+					Prefetch::read(node_next_ptr->right_son());
+				}
+#endif
 				node_ptr = node_ptr->merge(node_ptr->right_son());
 				node_ptr->right_son() = nullptr;
-				this->queue_->push(node_ptr);
+				queue.push_back(node_ptr);
 				node_ptr = node_next_ptr;
 			}
-			node_ptr = this->queue_->front();
-			this->queue_->pop();
-			while (!this->queue_->empty())
+			size_t front = 0;
+			node_ptr = queue[front++];
+			while (front < queue.size())
 			{
-				node_ptr = node_ptr->merge(this->queue_->front());
-				this->queue_->pop();
-				this->queue_->push(node_ptr);
-				node_ptr = this->queue_->front();
-				this->queue_->pop();
+				node_ptr = node_ptr->merge(queue[front++]);
+				queue.push_back(node_ptr);
+				node_ptr = queue[front++];
 			}
+			queue.clear();
 		}
 		node_ptr->parent() = nullptr;
 	}
@@ -0,0 +1,35 @@
+#pragma once
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Prepna softvrovho prednatania pri preusporiadan hld, predvolene vypnut, 1 ho zapne
+/// </summary>
+#ifndef PRIORITY_QUEUE_PREFETCH
+#define PRIORITY_QUEUE_PREFETCH 0
+#endif
+
+/// <summary>
+/// Softvrov prednatanie prvkov do vyrovnvacej pamte pred ich porovnanm
+/// </summary>
+class Prefetch
+{
+public:
+	/// <summary>
+	/// Poiada procesor o natanie riadku vyrovnvacej pamte s adresou address, neak na dokonenie a adresu nedereferencuje
+	/// </summary>
+	/// <param name="address">Adresa, me by nullptr</param>
+	static void read(const void* address);
+};
+
+inline void Prefetch::read(const void* address)
+{
+#if PRIORITY_QUEUE_PREFETCH && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch((const char*)address, _MM_HINT_T0);
+#elif PRIORITY_QUEUE_PREFETCH && (defined(__GNUC__) || defined(__clang__))
+	__builtin_prefetch(address);
+#else
+	(void)address;
+#endif
+}
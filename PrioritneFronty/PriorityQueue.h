@@ -1,8 +1,92 @@
 #pragma once
 #include "PriorityQueueItems.h"
+#include <new>
 #include <stdexcept>
+#include <thread>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+/// <summary>
+/// Typ opercie v dvke
+/// </summary>
+enum class OperationType
+{
+	/// <summary>
+	/// Vloenie prvku
+	/// </summary>
+	PUSH,
+	/// <summary>
+	/// Zmena priority prvku
+	/// </summary>
+	CHANGE_PRIORITY
+};
+
+/// <summary>
+/// Opercia v dvke aplikovanej na prioritn front
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class PriorityQueueOperation
+{
+private:
+	/// <summary>
+	/// Typ opercie
+	/// </summary>
+	OperationType type_;
+	/// <summary>
+	/// Identifiktor prvku
+	/// </summary>
+	int identifier_;
+	/// <summary>
+	/// Priorita vkladanho prvku alebo nov priorita prvku
+	/// </summary>
+	Priority priority_;
+	/// <summary>
+	/// Dta vkladanho prvku
+	/// </summary>
+	Data data_;
+	/// <summary>
+	/// Vytvoren prvok pri vloen, prvok ktormu sa men priorita pri zmene priority
+	/// </summary>
+	PriorityQueueItem<Priority, Data>* node_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="type">Typ opercie</param>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Dta, pri zmene priority sa nepouij</param>
+	PriorityQueueOperation(const OperationType type, const int identifier, const Priority& priority, const Data& data = Data());
+	/// <summary>
+	/// Vrti typ opercie
+	/// </summary>
+	/// <returns>Typ opercie</returns>
+	OperationType type() const;
+	/// <summary>
+	/// Vrti identifiktor prvku
+	/// </summary>
+	/// <returns>Identifiktor prvku</returns>
+	int identifier() const;
+	/// <summary>
+	/// Vrti prioritu
+	/// </summary>
+	/// <returns>Priorita</returns>
+	Priority& priority();
+	/// <summary>
+	/// Vrti dta
+	/// </summary>
+	/// <returns>Dta</returns>
+	Data& data();
+	/// <summary>
+	/// Vrti prvok, ktorho sa opercia tka
+	/// </summary>
+	/// <returns>Prvok</returns>
+	PriorityQueueItem<Priority, Data>*& node();
+};
+
 /// <summary>
 /// Abstraktn predok pre vetk implementcie prioritnho frontu
 /// </summary>
@@ -11,12 +95,42 @@
 template <typename Priority, typename Data>
 class PriorityQueue
 {
+private:
+	/// <summary>
+	/// Prznak, i sa odobran prvky odkladaj na optovn pouitie
+	/// </summary>
+	bool item_pooling_;
+	/// <summary>
+	/// Odobran prvky pripraven na optovn pouitie
+	/// </summary>
+	std::vector<PriorityQueueItem<Priority, Data>*>* free_items_;
+	/// <summary>
+	/// Poet prvkov, pre ktor bolo potrebn alokova pam
+	/// </summary>
+	size_t item_allocation_count_;
+	/// <summary>
+	/// Zru odloen prvky
+	/// </summary>
+	void release_free_items();
 protected:
 	/// <summary>
 	/// Abstraktn kontruktor
 	/// </summary>
 	PriorityQueue();
 	/// <summary>
+	/// Vytvor prvok, ak je zapnut odkladanie prvkov, pouije odloen prvok rovnakho typu
+	/// </summary>
+	/// <typeparam name="Item">Typ prvku</typeparam>
+	/// <param name="arguments">Parametre kontruktora prvku</param>
+	/// <returns>Vytvoren prvok</returns>
+	template <typename Item, typename... Arguments>
+	Item* create_item(Arguments&&... arguments);
+	/// <summary>
+	/// Zru prvok odobran z prioritnho frontu, ak je zapnut odkladanie prvkov, odlo ho na optovn pouitie
+	/// </summary>
+	/// <param name="node">Prvok, ktor u nem synov</param>
+	void destroy_item(PriorityQueueItem<Priority, Data>* node);
+	/// <summary>
 	/// Uprav prioritn front po zven prority prvku
 	/// </summary>
 	/// <param name="node">Prvok so zvenou prioritou</param>
@@ -26,12 +140,33 @@ protected:
 	/// </summary>
 	/// <param name="node">Prvok so znen prioritou</param>
 	virtual void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) = 0;
+	/// <summary>
+	/// Poet operci dvky pripadajci na jedno vlkno pri paralelnom spracovan
+	/// </summary>
+	static const size_t PARALLEL_BATCH_SIZE = 4096;
+	/// <summary>
+	/// Vrti poet vlkien, ktor sa oplat poui na spracovanie dvky
+	/// </summary>
+	/// <param name="batch_size">Vekos dvky</param>
+	/// <returns>Poet vlkien, 1 ak sa m dvka spracova sekvenne</returns>
+	static size_t batch_thread_count(const size_t batch_size);
 public:
 	/// <summary>
 	/// Virtulny detruktor
 	/// </summary>
 	virtual ~PriorityQueue();
 	/// <summary>
+	/// Zapne alebo vypne odkladanie odobranch prvkov na optovn pouitie pri alom vloen
+	/// Odloen prvky patria prioritnmu frontu, preto sa smie pouva len z jednho vlkna naraz
+	/// </summary>
+	/// <param name="item_pooling">Prznak, i sa maj prvky odklada</param>
+	void set_item_pooling(const bool item_pooling);
+	/// <summary>
+	/// Vrti poet prvkov, pre ktor bolo potrebn alokova pam
+	/// </summary>
+	/// <returns>Poet alokci prvkov</returns>
+	size_t item_allocation_count() const;
+	/// <summary>
 	/// Vyme vetky prvky z prioritnho frontu
 	/// </summary>
 	virtual void clear() = 0;
@@ -60,26 +195,157 @@ public:
 	/// <returns>Hodnota dt</returns>
 	virtual Data& find_min() = 0;
 	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	virtual PriorityQueueItem<Priority, Data>* find_min_item() = 0;
+	/// <summary>
 	/// Pripoj k prioritnmu frontu prvky z other_heap
 	/// </summary>
 	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
 	virtual void merge(PriorityQueue<Priority, Data>* other_heap) = 0;
 	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps vyvenou redukciou po dvojiciach, pri vekom pote prvkov paralelne
+	/// Fronty musia by rovnakho typu ako tento front, s zruen a zoznam heaps je vyprzdnen
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	virtual void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps);
+	/// <summary>
 	/// Zmen prioritu prvku
 	/// </summary>
 	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	virtual void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority);
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	virtual void erase(PriorityQueueItem<Priority, Data>* node) = 0;
+	/// <summary>
+	/// Vlo do prioritnho frontu dvku prvkov, vytvoren prvky ulo do operci
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	virtual void push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations);
+	/// <summary>
+	/// Zmen priority dvky prvkov, pri opakovanej zmene toho istho prvku plat posledn
+	/// </summary>
+	/// <param name="operations">Opercie zmeny priority s nastavenmi prvkami</param>
+	virtual void change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations);
+	/// <summary>
+	/// Vyberie z prioritnho frontu najviac count prvkov s najvou prioritou a prid ich do out v porad poda priority
+	/// </summary>
+	/// <param name="count">Najv poet vybranch prvkov</param>
+	/// <param name="out">Identifiktory a dta vybranch prvkov</param>
+	/// <returns>Poet vybranch prvkov</returns>
+	virtual size_t pop_n(const size_t count, std::vector<std::pair<int, Data>>& out);
 };
 
 template<typename Priority, typename Data>
-inline PriorityQueue<Priority, Data>::PriorityQueue()
+inline PriorityQueueOperation<Priority, Data>::PriorityQueueOperation(const OperationType type, const int identifier, const Priority& priority, const Data& data) :
+	type_(type), identifier_(identifier), priority_(priority), data_(data), node_(nullptr)
+{
+}
+
+template<typename Priority, typename Data>
+inline OperationType PriorityQueueOperation<Priority, Data>::type() const
+{
+	return this->type_;
+}
+
+template<typename Priority, typename Data>
+inline int PriorityQueueOperation<Priority, Data>::identifier() const
+{
+	return this->identifier_;
+}
+
+template<typename Priority, typename Data>
+inline Priority& PriorityQueueOperation<Priority, Data>::priority()
+{
+	return this->priority_;
+}
+
+template<typename Priority, typename Data>
+inline Data& PriorityQueueOperation<Priority, Data>::data()
+{
+	return this->data_;
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>*& PriorityQueueOperation<Priority, Data>::node()
+{
+	return this->node_;
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueue<Priority, Data>::PriorityQueue() :
+	item_pooling_(false), free_items_(new std::vector<PriorityQueueItem<Priority, Data>*>()), item_allocation_count_(0)
 {
 }
 
 template<typename Priority, typename Data>
 inline PriorityQueue<Priority, Data>::~PriorityQueue()
 {
+	this->release_free_items();
+	delete this->free_items_;
+	this->free_items_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::release_free_items()
+{
+	for (PriorityQueueItem<Priority, Data>* item : *this->free_items_)
+	{
+		delete item;
+	}
+	this->free_items_->clear();
+}
+
+template<typename Priority, typename Data>
+template<typename Item, typename... Arguments>
+inline Item* PriorityQueue<Priority, Data>::create_item(Arguments&&... arguments)
+{
+	if (!this->free_items_->empty())
+	{
+		PriorityQueueItem<Priority, Data>* item = this->free_items_->back();
+		this->free_items_->pop_back();
+		if (typeid(*item) == typeid(Item))
+		{
+			item->~PriorityQueueItem();
+			return new (item) Item(std::forward<Arguments>(arguments)...);
+		}
+		delete item;
+	}
+	this->item_allocation_count_++;
+	return new Item(std::forward<Arguments>(arguments)...);
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::destroy_item(PriorityQueueItem<Priority, Data>* node)
+{
+	if (this->item_pooling_)
+	{
+		this->free_items_->push_back(node);
+	}
+	else
+	{
+		delete node;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::set_item_pooling(const bool item_pooling)
+{
+	this->item_pooling_ = item_pooling;
+	if (!item_pooling)
+	{
+		this->release_free_items();
+	}
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueue<Priority, Data>::item_allocation_count() const
+{
+	return this->item_allocation_count_;
 }
 
 template<typename Priority, typename Data>
@@ -96,3 +362,104 @@ inline void PriorityQueue<Priority, Data>::change_priority(PriorityQueueItem<Pri
 		this->priority_was_decreased(node);
 	}
 }
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueue<Priority, Data>::batch_thread_count(const size_t batch_size)
+{
+	if (batch_size < 2 * PARALLEL_BATCH_SIZE)
+	{
+		return 1;
+	}
+	static const size_t hardware_thread_count = std::thread::hardware_concurrency();
+	size_t thread_count = std::min<size_t>(hardware_thread_count, batch_size / PARALLEL_BATCH_SIZE);
+	return thread_count > 1 ? thread_count : 1;
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	size_t total_size = 0;
+	for (PriorityQueue<Priority, Data>* heap : heaps)
+	{
+		total_size += heap->size();
+	}
+
+	while (heaps.size() > 1)
+	{
+		size_t pair_count = heaps.size() / 2;
+		size_t thread_count = std::min(PriorityQueue<Priority, Data>::batch_thread_count(total_size), pair_count);
+		if (thread_count == 1)
+		{
+			for (size_t i = 0; i < pair_count; i++)
+			{
+				heaps[2 * i]->merge(heaps[2 * i + 1]);
+			}
+		}
+		else
+		{
+			std::vector<std::thread> threads;
+			for (size_t t = 0; t < thread_count; t++)
+			{
+				threads.emplace_back([&heaps, pair_count, thread_count, t]()
+				{
+					for (size_t i = pair_count * t / thread_count; i < pair_count * (t + 1) / thread_count; i++)
+					{
+						heaps[2 * i]->merge(heaps[2 * i + 1]);
+					}
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		for (size_t i = 0; i < pair_count; i++)
+		{
+			heaps[i] = heaps[2 * i];
+		}
+		if (heaps.size() % 2)
+		{
+			heaps[pair_count] = heaps.back();
+			pair_count++;
+		}
+		heaps.resize(pair_count);
+	}
+
+	if (!heaps.empty())
+	{
+		this->merge(heaps.front());
+		heaps.clear();
+	}
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueue<Priority, Data>::pop_n(const size_t count, std::vector<std::pair<int, Data>>& out)
+{
+	size_t popped = 0;
+	int identifier;
+	for (; popped < count && this->size() > 0; popped++)
+	{
+		Data data = this->pop(identifier);
+		out.emplace_back(identifier, data);
+	}
+	return popped;
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		this->push(operation.identifier(), operation.priority(), operation.data(), operation.node());
+	}
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueue<Priority, Data>::change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	for (PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		this->change_priority(operation.node(), operation.priority());
+	}
+}
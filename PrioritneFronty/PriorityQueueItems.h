@@ -1,5 +1,7 @@
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 /// <summary>
 /// Abstraktn predok pre prvky prioritnho frontu
@@ -85,6 +87,110 @@ public:
 	int& index();
 };
 
+/// <summary>
+/// Prvok pouit v priehradkovom fronte
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class BucketItem : public PriorityQueueItem<Priority, Data>
+{
+protected:
+	/// <summary>
+	/// Smernky na susedn prvky v cyklickom zozname priehradky
+	/// </summary>
+	BucketItem<Priority, Data>* previous_, * next_;
+	/// <summary>
+	/// Index priehradky, v ktorej je prvok uloen
+	/// </summary>
+	size_t bucket_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="identifier">Identifiktor</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Dta</param>
+	BucketItem(const int identifier, const Priority& priority, const Data& data);
+	/// <summary>
+	/// Vrti predchdzajci prvok v priehradke
+	/// </summary>
+	/// <returns>Predchdzajci prvok</returns>
+	BucketItem*& previous();
+	/// <summary>
+	/// Vrti nasledujci prvok v priehradke
+	/// </summary>
+	/// <returns>Nasledujci prvok</returns>
+	BucketItem*& next();
+	/// <summary>
+	/// Vrti index priehradky prvku
+	/// </summary>
+	/// <returns>Index priehradky</returns>
+	size_t& bucket();
+};
+
+/// <summary>
+/// Prvok pouit v sbenom skip liste
+/// Najni bit smernka na nasledovnka na rovni 0 oznauje, e nasledovnk je logicky odstrnen
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class SkipListItem : public PriorityQueueItem<Priority, Data>
+{
+protected:
+	/// <summary>
+	/// Poet rovn prvku
+	/// </summary>
+	int level_;
+	/// <summary>
+	/// Smernky na nasledovnkov na jednotlivch rovniach
+	/// </summary>
+	std::atomic<uintptr_t>* next_;
+	/// <summary>
+	/// Prznak, e prvok ete nie je pripojen na vetkch rovniach
+	/// </summary>
+	std::atomic<bool> inserting_;
+	/// <summary>
+	/// Nasledujci prvok v zozname prvkov akajcich na dealokciu
+	/// </summary>
+	SkipListItem<Priority, Data>* retired_next_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="identifier">Identifiktor</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Dta</param>
+	/// <param name="level">Poet rovn prvku</param>
+	SkipListItem(const int identifier, const Priority& priority, const Data& data, const int level);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~SkipListItem();
+	/// <summary>
+	/// Vrti poet rovn prvku
+	/// </summary>
+	/// <returns>Poet rovn</returns>
+	int level() const;
+	/// <summary>
+	/// Vrti smernk na nasledovnka na rovni level
+	/// </summary>
+	/// <param name="level">rove</param>
+	/// <returns>Smernk na nasledovnka</returns>
+	std::atomic<uintptr_t>& next(const int level);
+	/// <summary>
+	/// Vrti prznak prebiehajceho vkladania
+	/// </summary>
+	/// <returns>Prznak vkladania</returns>
+	std::atomic<bool>& inserting();
+	/// <summary>
+	/// Vrti nasledujci prvok v zozname prvkov akajcich na dealokciu
+	/// </summary>
+	/// <returns>Nasledujci prvok</returns>
+	SkipListItem*& retired_next();
+};
+
 /// <summary>
 /// Prvok pouit v explicitnom binrnom strome
 /// </summary>
@@ -279,7 +385,8 @@ public:
 	/// <returns>Oznaenie prvku</returns>
 	bool& flag();
 	/// <summary>
-	/// Prvok node sa nastav ako av potomok
+	/// Prvok node sa nastav ako av potomok a usporiadan predok sa nastav len jemu
+	/// Postupnos srodencov sa presva len v rmci toho istho predka, preto ich usporiadan predok zostva platn
 	/// </summary>
 	/// <param name="node">Pripjan prvok</param>
 	/// <returns>Prvok</returns>
@@ -298,6 +405,70 @@ inline int& ArrayItem<Priority, Data>::index()
 	return this->index_;
 };
 
+template <typename Priority, typename Data>
+inline BucketItem<Priority, Data>::BucketItem(const int identifier, const Priority& priority, const Data& data) :
+	PriorityQueueItem<Priority, Data>(identifier, priority, data), previous_(this), next_(this), bucket_(0)
+{
+};
+
+template <typename Priority, typename Data>
+inline BucketItem<Priority, Data>*& BucketItem<Priority, Data>::previous()
+{
+	return this->previous_;
+};
+
+template <typename Priority, typename Data>
+inline BucketItem<Priority, Data>*& BucketItem<Priority, Data>::next()
+{
+	return this->next_;
+};
+
+template <typename Priority, typename Data>
+inline size_t& BucketItem<Priority, Data>::bucket()
+{
+	return this->bucket_;
+};
+
+template <typename Priority, typename Data>
+inline SkipListItem<Priority, Data>::SkipListItem(const int identifier, const Priority& priority, const Data& data, const int level) :
+	PriorityQueueItem<Priority, Data>(identifier, priority, data), level_(level), next_(new std::atomic<uintptr_t>[level]), inserting_(true), retired_next_(nullptr)
+{
+	for (int i = 0; i < level; i++)
+	{
+		this->next_[i].store(0, std::memory_order_relaxed);
+	}
+};
+
+template <typename Priority, typename Data>
+inline SkipListItem<Priority, Data>::~SkipListItem()
+{
+	delete[] this->next_;
+};
+
+template <typename Priority, typename Data>
+inline int SkipListItem<Priority, Data>::level() const
+{
+	return this->level_;
+};
+
+template <typename Priority, typename Data>
+inline std::atomic<uintptr_t>& SkipListItem<Priority, Data>::next(const int level)
+{
+	return this->next_[level];
+};
+
+template <typename Priority, typename Data>
+inline std::atomic<bool>& SkipListItem<Priority, Data>::inserting()
+{
+	return this->inserting_;
+};
+
+template <typename Priority, typename Data>
+inline SkipListItem<Priority, Data>*& SkipListItem<Priority, Data>::retired_next()
+{
+	return this->retired_next_;
+};
+
 template<typename Priority, typename Data>
 inline BinaryTreeItem<Priority, Data>::BinaryTreeItem(const int identifier, const Priority& priority, const Data& data) :
 	PriorityQueueItem<Priority, Data>(identifier, priority, data), left_son_(nullptr), right_son_(nullptr), parent_(nullptr)
@@ -608,13 +779,7 @@ inline FibonacciHeapItem<Priority, Data>* FibonacciHeapItem<Priority, Data>::lef
 	{
 		FibonacciHeapItem* casted_node = (FibonacciHeapItem*)node;
 		casted_node->parent_ = this;
-		if (casted_node->ordered_ancestor_ != this)
-		{
-			for (FibonacciHeapItem* node_ptr = casted_node; node_ptr; node_ptr = (FibonacciHeapItem*)(node_ptr->right_son_))
-			{
-				node_ptr->ordered_ancestor_ = this;
-			}
-		}
+		casted_node->ordered_ancestor_ = this;
 	}
 	this->left_son_ = node;
 	return this;
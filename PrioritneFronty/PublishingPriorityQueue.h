@@ -0,0 +1,325 @@
+#pragma once
+#include "PriorityQueue.h"
+#include <atomic>
+
+/// <summary>
+/// Prioritn front, ktor po kadej zmene zverejn prioritu a identifiktor minima cez seqlock
+/// Front men jedno vlkno, ubovon poet vlkien me sasne ta minimum cez read_min bez zamykania,
+/// zapisujce vlkno na itateov nikdy neak, Priority mus by trivilne koprovaten typ
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class PublishingPriorityQueue : public PriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Obalen prioritn front
+	/// </summary>
+	PriorityQueue<Priority, Data>* priority_queue_;
+	/// <summary>
+	/// Potadlo seqlocku, neprne poas zpisu
+	/// </summary>
+	alignas(64) std::atomic<unsigned int> sequence_;
+	/// <summary>
+	/// Zverejnen priorita minima
+	/// </summary>
+	std::atomic<Priority> published_priority_;
+	/// <summary>
+	/// Zverejnen identifiktor minima
+	/// </summary>
+	std::atomic<int> published_identifier_;
+	/// <summary>
+	/// Zverejnen prznak przdneho frontu
+	/// </summary>
+	std::atomic<bool> published_empty_;
+	/// <summary>
+	/// Naposledy zverejnen prvok, ak sa minimum nezmenilo, nezapisuje sa
+	/// </summary>
+	alignas(64) PriorityQueueItem<Priority, Data>* published_item_;
+	/// <summary>
+	/// Priorita naposledy zverejnenho prvku v ase zverejnenia
+	/// </summary>
+	Priority published_item_priority_;
+	/// <summary>
+	/// Zverejn minimum obalenho frontu, ak sa zmenilo
+	/// </summary>
+	void publish();
+protected:
+	/// <summary>
+	/// Nevol sa, zmena priority sa deleguje obalenmu frontu
+	/// </summary>
+	/// <param name="node">Prvok so zvenou prioritou</param>
+	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Nevol sa, zmena priority sa deleguje obalenmu frontu
+	/// </summary>
+	/// <param name="node">Prvok so znenou prioritou</param>
+	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="priority_queue">Obalen prioritn front, ktorho vlastnctvo preber</param>
+	PublishingPriorityQueue(PriorityQueue<Priority, Data>* priority_queue);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~PublishingPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vrti poet prvkov v prioritnom fronte
+	/// </summary>
+	/// <returns>Poet prvkov v prioritnom fronte</returns>
+	size_t size() const override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky z other_heap, ktor mus by tie PublishingPriorityQueue
+	/// </summary>
+	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
+	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky zo vetkch frontov heaps, ktor musia by tie PublishingPriorityQueue
+	/// </summary>
+	/// <param name="heaps">Prioritn fronty, ktorch prvky maj by pripojen</param>
+	void merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps) override;
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override;
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho, minimum zverejn, ak bol prvok zverejnenm minimom
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Vlo do prioritnho frontu dvku prvkov, minimum zverejn raz po celej dvke
+	/// </summary>
+	/// <param name="operations">Opercie vloenia</param>
+	void push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
+	/// Zmen priority dvky prvkov, minimum zverejn raz po celej dvke
+	/// </summary>
+	/// <param name="operations">Opercie zmeny priority s nastavenmi prvkami</param>
+	void change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu najviac count prvkov s najvou prioritou, minimum zverejn raz po celom vbere
+	/// </summary>
+	/// <param name="count">Najv poet vybranch prvkov</param>
+	/// <param name="out">Identifiktory a dta vybranch prvkov</param>
+	/// <returns>Poet vybranch prvkov</returns>
+	size_t pop_n(const size_t count, std::vector<std::pair<int, Data>>& out) override;
+	/// <summary>
+	/// Preta zverejnen minimum, me by volan z ubovonho vlkna sasne so zmenami frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="priority">Priorita prvku s najvou prioritou</param>
+	/// <returns>True, ak front nebol przdny</returns>
+	bool read_min(int& identifier, Priority& priority) const;
+};
+
+template<typename Priority, typename Data>
+inline PublishingPriorityQueue<Priority, Data>::PublishingPriorityQueue(PriorityQueue<Priority, Data>* priority_queue) :
+	PriorityQueue<Priority, Data>(),
+	priority_queue_(priority_queue),
+	sequence_(0),
+	published_priority_(Priority()),
+	published_identifier_(0),
+	published_empty_(true),
+	published_item_(nullptr),
+	published_item_priority_(Priority())
+{
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline PublishingPriorityQueue<Priority, Data>::~PublishingPriorityQueue()
+{
+	delete this->priority_queue_;
+	this->priority_queue_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::clear()
+{
+	this->priority_queue_->clear();
+	this->published_item_ = nullptr;
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline size_t PublishingPriorityQueue<Priority, Data>::size() const
+{
+	return this->priority_queue_->size();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
+{
+	this->priority_queue_->push(identifier, priority, data, data_item);
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline Data PublishingPriorityQueue<Priority, Data>::pop(int& identifier)
+{
+	Data data = this->priority_queue_->pop(identifier);
+	this->published_item_ = nullptr;
+	this->publish();
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline Data& PublishingPriorityQueue<Priority, Data>::find_min()
+{
+	return this->priority_queue_->find_min();
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* PublishingPriorityQueue<Priority, Data>::find_min_item()
+{
+	return this->priority_queue_->find_min_item();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
+{
+	PublishingPriorityQueue<Priority, Data>* heap = (PublishingPriorityQueue<Priority, Data>*)other_heap;
+	this->priority_queue_->merge(heap->priority_queue_);
+	heap->priority_queue_ = nullptr;
+	delete heap;
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::merge_all(std::vector<PriorityQueue<Priority, Data>*>& heaps)
+{
+	for (PriorityQueue<Priority, Data>*& other_heap : heaps)
+	{
+		PublishingPriorityQueue<Priority, Data>* heap = (PublishingPriorityQueue<Priority, Data>*)other_heap;
+		other_heap = heap->priority_queue_;
+		heap->priority_queue_ = nullptr;
+		delete heap;
+	}
+	this->priority_queue_->merge_all(heaps);
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority)
+{
+	this->priority_queue_->change_priority(node, priority);
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	bool published = node == this->published_item_;
+	this->priority_queue_->erase(node);
+	if (published)
+	{
+		this->published_item_ = nullptr;
+		this->publish();
+	}
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::push_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	this->priority_queue_->push_batch(operations);
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::change_priority_batch(std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	this->priority_queue_->change_priority_batch(operations);
+	this->publish();
+}
+
+template<typename Priority, typename Data>
+inline size_t PublishingPriorityQueue<Priority, Data>::pop_n(const size_t count, std::vector<std::pair<int, Data>>& out)
+{
+	size_t popped = this->priority_queue_->pop_n(count, out);
+	this->published_item_ = nullptr;
+	this->publish();
+	return popped;
+}
+
+template<typename Priority, typename Data>
+inline bool PublishingPriorityQueue<Priority, Data>::read_min(int& identifier, Priority& priority) const
+{
+	unsigned int sequence_before, sequence_after;
+	bool empty;
+	do
+	{
+		sequence_before = this->sequence_.load(std::memory_order_acquire);
+		empty = this->published_empty_.load(std::memory_order_relaxed);
+		priority = this->published_priority_.load(std::memory_order_relaxed);
+		identifier = this->published_identifier_.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		sequence_after = this->sequence_.load(std::memory_order_relaxed);
+	} while ((sequence_before & 1) || sequence_before != sequence_after);
+	return !empty;
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::publish()
+{
+	PriorityQueueItem<Priority, Data>* item = this->priority_queue_->size() > 0 ? this->priority_queue_->find_min_item() : nullptr;
+	if (item && item == this->published_item_ && item->priority() == this->published_item_priority_)
+	{
+		return;
+	}
+	unsigned int sequence = this->sequence_.load(std::memory_order_relaxed);
+	this->sequence_.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	this->published_empty_.store(item == nullptr, std::memory_order_relaxed);
+	if (item)
+	{
+		this->published_priority_.store(item->priority(), std::memory_order_relaxed);
+		this->published_identifier_.store(item->identifier(), std::memory_order_relaxed);
+		this->published_item_priority_ = item->priority();
+	}
+	this->sequence_.store(sequence + 2, std::memory_order_release);
+	this->published_item_ = item;
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>*)
+{
+}
+
+template<typename Priority, typename Data>
+inline void PublishingPriorityQueue<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>*)
+{
+}
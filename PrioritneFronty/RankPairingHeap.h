@@ -1,6 +1,21 @@
 #pragma once
 #include "LazyBinomialQueue.h"
 
+/// <summary>
+/// Pravidlo pre vpoet ranku prvku z rankov jeho potomkov
+/// </summary>
+enum class RankRule
+{
+	/// <summary>
+	/// Rozdiely rankov potomkov s 1 a 1, alebo 0 a ubovon
+	/// </summary>
+	TYPE_1,
+	/// <summary>
+	/// Rozdiely rankov potomkov s 1 a 1, 1 a 2, alebo 0 a aspo 2
+	/// </summary>
+	TYPE_2
+};
+
 /// <summary>
 /// rovov provacia halda
 /// </summary>
@@ -10,6 +25,21 @@ template <typename Priority, typename Data>
 class RankPairingHeap : public LazyBinomialHeap<Priority, Data>
 {
 private:
+	/// <summary>
+	/// Pravidlo pre vpoet ranku
+	/// </summary>
+	RankRule rank_rule_;
+	/// <summary>
+	/// Stratgia zluovania koreov
+	/// </summary>
+	ConsolidationStrategy consolidation_strategy_;
+	/// <summary>
+	/// Vrti rank prvku, ktor nie je koreom, poda rankov jeho potomkov
+	/// </summary>
+	/// <param name="left_son_degree">Rank avho potomka, -1 ak neexistuje</param>
+	/// <param name="right_son_degree">Rank pravho potomka, -1 ak neexistuje</param>
+	/// <returns>Rank prvku</returns>
+	int rank(int left_son_degree, int right_son_degree);
 	/// <summary>
 	/// Nastol stupov pravidlo od prvku smerom ku koreu
 	/// </summary>
@@ -17,7 +47,7 @@ private:
 	void restore_degree_rule(DegreeBinaryTreeItem<Priority, Data>* node);
 protected:
 	/// <summary>
-	/// Zli prvky v pravej chrbtici atribtu root_ a parametra node viacprechodovou stratgiou
+	/// Zli prvky v pravej chrbtici atribtu root_ a parametra node zvolenou stratgiou
 	/// </summary>
 	/// <param name="node">Prv prvok v postupnosti prvkov, ktor sa maj zli</param>
 	void consolidate_root(BinaryTreeItem<Priority, Data>* node) override;
@@ -28,22 +58,32 @@ protected:
 	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
 	/// <summary>
 	/// Vystrihne potomkov prvku s vyou prioritou a nastav stupov pravidlo od priameho predka poslednho vystrihnutho prvku
+	/// Ak je prvok koreom root_, hadanie minima odlo do najbliieho zluovania
 	/// </summary>
 	/// <param name="node">Prvok so znenou prioritou</param>
 	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
 public:
-
-	RankPairingHeap();
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="rank_rule">Pravidlo pre vpoet ranku</param>
+	/// <param name="consolidation_strategy">Stratgia zluovania koreov</param>
+	RankPairingHeap(RankRule rank_rule = RankRule::TYPE_2, ConsolidationStrategy consolidation_strategy = ConsolidationStrategy::MULTI_PASS);
 	~RankPairingHeap();
 	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
 
 	Data pop(int& identifier) override { return this->LazyBinomialHeap<Priority, Data>::pop(identifier); };
 	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Vystrihne prvok, nastol stupov pravidlo od priameho predka, odstrni prvok zo zoznamu koreov a zru ho
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
 };
 
 template<typename Priority, typename Data>
-inline RankPairingHeap<Priority, Data>::RankPairingHeap() :
-	LazyBinomialHeap<Priority, Data>()
+inline RankPairingHeap<Priority, Data>::RankPairingHeap(RankRule rank_rule, ConsolidationStrategy consolidation_strategy) :
+	LazyBinomialHeap<Priority, Data>(), rank_rule_(rank_rule), consolidation_strategy_(consolidation_strategy)
 {
 }
 
@@ -55,7 +95,17 @@ inline RankPairingHeap<Priority, Data>::~RankPairingHeap()
 template<typename Priority, typename Data>
 inline void RankPairingHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
 {
-	data_item = this->LazyBinomialHeap<Priority, Data>::push(new DegreeBinaryTreeItem<Priority, Data>(identifier, priority, data));
+	data_item = this->LazyBinomialHeap<Priority, Data>::push(this->template create_item<DegreeBinaryTreeItem<Priority, Data>>(identifier, priority, data));
+}
+
+template<typename Priority, typename Data>
+inline int RankPairingHeap<Priority, Data>::rank(int left_son_degree, int right_son_degree)
+{
+	if (this->rank_rule_ == RankRule::TYPE_1)
+	{
+		return left_son_degree == right_son_degree ? left_son_degree + 1 : std::max(left_son_degree, right_son_degree);
+	}
+	return abs(left_son_degree - right_son_degree) > 1 ? std::max(left_son_degree, right_son_degree) : std::max(left_son_degree, right_son_degree) + 1;
 }
 
 template<typename Priority, typename Data>
@@ -71,22 +121,12 @@ inline void RankPairingHeap<Priority, Data>::restore_degree_rule(DegreeBinaryTre
 			right_son_degree = node_ptr->right_son() && node_ptr->right_son()->parent() ? ((DegreeBinaryTreeItem<Priority, Data>*)node_ptr->right_son())->degree() : -1;
 			if (node_ptr->parent())
 			{
-				if (abs(left_son_degree - right_son_degree) > 1)
-				{
-					degree = std::max(left_son_degree, right_son_degree);
-				}
-				else
-				{
-					degree = std::max(left_son_degree, right_son_degree) + 1;
-				}
-				if (node_ptr->degree() < degree)
+				degree = this->rank(left_son_degree, right_son_degree);
+				if (node_ptr->degree() <= degree)
 				{
 					return;
 				}
-				else
-				{
-					node_ptr->degree() = degree;
-				}
+				node_ptr->degree() = degree;
 				node_ptr = (DegreeBinaryTreeItem<Priority, Data>*)node_ptr->parent();
 			}
 			else
@@ -101,7 +141,14 @@ inline void RankPairingHeap<Priority, Data>::restore_degree_rule(DegreeBinaryTre
 template<typename Priority, typename Data>
 inline void RankPairingHeap<Priority, Data>::consolidate_root(BinaryTreeItem<Priority, Data>* node)
 {
-	this->consolidate_root_using_multipass(node, (int)(log(this->size_) * 2.1) + 2);
+	if (this->consolidation_strategy_ == ConsolidationStrategy::ONE_PASS)
+	{
+		this->consolidate_root_using_onepass(node, (int)(log(this->size_) * 2.1) + 2);
+	}
+	else
+	{
+		this->consolidate_root_using_multipass(node, (int)(log(this->size_) * 2.1) + 2);
+	}
 }
 
 template<typename Priority, typename Data>
@@ -121,21 +168,27 @@ inline void RankPairingHeap<Priority, Data>::priority_was_increased(PriorityQueu
 	}
 }
 
+template<typename Priority, typename Data>
+inline void RankPairingHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	DegreeBinaryTreeItem<Priority, Data>* casted_node = (DegreeBinaryTreeItem<Priority, Data>*)node;
+	if (casted_node->parent())
+	{
+		DegreeBinaryTreeItem<Priority, Data>* parent = (DegreeBinaryTreeItem<Priority, Data>*)casted_node->parent();
+		this->add_root_item(casted_node->cut());
+		this->restore_degree_rule(parent);
+	}
+	this->remove_root(casted_node);
+	this->destroy_item(casted_node);
+}
+
 template<typename Priority, typename Data>
 inline void RankPairingHeap<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>* node)
 {
 	BinaryTreeItem<Priority, Data>* last_change = nullptr;
 	if (this->root_ == node)
 	{
-		BinaryTreeItem<Priority, Data>* new_root = this->root_;
-		for (BinaryTreeItem<Priority, Data>* node_ptr = this->root_->right_son(); node_ptr != this->root_; node_ptr = node_ptr->right_son())
-		{
-			if (*node_ptr < *new_root)
-			{
-				new_root = node_ptr;
-			}
-		}
-		this->root_ = new_root;
+		this->root_dirty_ = true;
 	}
 	for (BinaryTreeItem<Priority, Data>* node_ptr = ((BinaryTreeItem<Priority, Data>*)node)->left_son(), *node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr; node_ptr;
 		node_ptr = node_next_ptr, node_next_ptr = node_ptr ? node_ptr->right_son() : nullptr)
@@ -0,0 +1,332 @@
+#pragma once
+#include "PriorityQueue.h"
+#include "SimdMinimum.h"
+#include <vector>
+
+/// <summary>
+/// tvorrna halda implementovan implicitnm zoznamom, ke zloen z priority a identifiktora s uloen v samostatnom svislom zozname
+/// a prvky s dtami v paralelnom zozname, najmenieho zo tyroch potomkov njde vektorovmi intrukciami
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority, cel slo so znamienkom, najviac 32-bitov</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class SimdHeap : public PriorityQueue<Priority, Data>
+{
+	static_assert(SimdMinimum::has_key<Priority>(), "SimdHeap: Priorita musi byt celociselna so znamienkom a najviac 32-bitova");
+private:
+	/// <summary>
+	/// Poet potomkov prvku, tyri 64-bitov ke zaberaj jeden 256-bitov register
+	/// </summary>
+	static const int ARITY = 4;
+	/// <summary>
+	/// Ke prvkov v porad implicitnho zoznamu
+	/// </summary>
+	std::vector<long long>* keys_;
+	/// <summary>
+	/// Prvky v porad implicitnho zoznamu
+	/// </summary>
+	std::vector<ArrayItem<Priority, Data>*>* items_;
+	/// <summary>
+	/// Sada intrukci pouit pri hadan najmenieho potomka
+	/// </summary>
+	SimdLevel level_;
+	/// <summary>
+	/// Vrti index potomka s najmenm kom prvku na indexe index, ak prvok nem potomkov, vrti index mimo zoznamu
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	/// <returns>Index najmenieho potomka</returns>
+	int min_son(const int index);
+	/// <summary>
+	/// Presunie prvok a jeho k na index index
+	/// </summary>
+	/// <param name="index">Cieov index</param>
+	/// <param name="key">K prvku</param>
+	/// <param name="item">Prvok</param>
+	void place(const int index, const long long key, ArrayItem<Priority, Data>* item);
+	/// <summary>
+	/// Posva prvok na indexe index smerom ku koreu, dokia nie je splnen haldov usporiadanie
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	void heapify_up(const int index);
+	/// <summary>
+	/// Posva prvok na indexe index smerom k listom, dokia nie je splnen haldov usporiadanie
+	/// </summary>
+	/// <param name="index">Index prvku</param>
+	void heapify_down(const int index);
+	/// <summary>
+	/// Odstrni posledn prvok zoznamu a presunie ho na index index
+	/// </summary>
+	/// <param name="index">Index uvonenho miesta</param>
+	void fill_from_back(const int index);
+protected:
+	/// <summary>
+	/// Aktualizuje k prvku a posva ho smerom ku koreu
+	/// </summary>
+	/// <param name="node">Prvok so zvenou prioritou</param>
+	void priority_was_increased(PriorityQueueItem<Priority, Data>* node) override;
+	/// <summary>
+	/// Aktualizuje k prvku a posva ho smerom k listom
+	/// </summary>
+	/// <param name="node">Prvok so znenou prioritou</param>
+	void priority_was_decreased(PriorityQueueItem<Priority, Data>* node) override;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="level">Najvyia povolen sada intrukci, pouije sa nanajv sada podporovan procesorom</param>
+	SimdHeap(const SimdLevel level = SimdLevel::SCALAR);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~SimdHeap();
+	/// <summary>
+	/// Vrti pouit sadu intrukci
+	/// </summary>
+	/// <returns>Sada intrukci</returns>
+	SimdLevel level() const;
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vrti poet prvkov v prioritnom fronte
+	/// </summary>
+	/// <returns>Poet prvkov v prioritnom fronte</returns>
+	size_t size() const override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	/// <param name="data_item">Vytvoren prvok</param>
+	void push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <returns>Hodnota dt</returns>
+	Data pop(int& identifier) override;
+	/// <summary>
+	/// Vrti dta s najvou prioritou
+	/// </summary>
+	/// <returns>Hodnota dt</returns>
+	Data& find_min() override;
+	/// <summary>
+	/// Vrti prvok s najvou prioritou
+	/// </summary>
+	/// <returns>Prvok s najvou prioritou</returns>
+	PriorityQueueItem<Priority, Data>* find_min_item() override;
+	/// <summary>
+	/// Pripoj k prioritnmu frontu prvky z other_heap
+	/// </summary>
+	/// <param name="other_heap">Prioritn front, ktorho prvky maj by pripojen</param>
+	void merge(PriorityQueue<Priority, Data>* other_heap) override;
+	/// <summary>
+	/// Zmen prioritu prvku
+	/// </summary>
+	/// <param name="node">Prvok, ktormu m by zmenen priorita</param>
+	/// <param name="priority">Nov priorita prvku</param>
+	void change_priority(PriorityQueueItem<Priority, Data>* node, const Priority& priority) override { this->PriorityQueue<Priority, Data>::change_priority(node, priority); };
+	/// <summary>
+	/// Odstrni prvok z prioritnho frontu a zru ho, na jeho miesto presunie posledn prvok zoznamu
+	/// </summary>
+	/// <param name="node">Odstraovan prvok</param>
+	void erase(PriorityQueueItem<Priority, Data>* node) override;
+};
+
+template<typename Priority, typename Data>
+inline SimdHeap<Priority, Data>::SimdHeap(const SimdLevel level) :
+	PriorityQueue<Priority, Data>(),
+	keys_(new std::vector<long long>()),
+	items_(new std::vector<ArrayItem<Priority, Data>*>()),
+	level_(SimdMinimum::usable_level(level))
+{
+}
+
+template<typename Priority, typename Data>
+inline SimdHeap<Priority, Data>::~SimdHeap()
+{
+	this->clear();
+	delete this->keys_;
+	delete this->items_;
+}
+
+template<typename Priority, typename Data>
+inline SimdLevel SimdHeap<Priority, Data>::level() const
+{
+	return this->level_;
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::clear()
+{
+	for (PriorityQueueItem<Priority, Data>* item : *this->items_)
+	{
+		delete item;
+	}
+	this->items_->clear();
+	this->keys_->clear();
+}
+
+template<typename Priority, typename Data>
+inline size_t SimdHeap<Priority, Data>::size() const
+{
+	return this->items_->size();
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data, PriorityQueueItem<Priority, Data>*& data_item)
+{
+	ArrayItem<Priority, Data>* new_node = this->template create_item<ArrayItem<Priority, Data>>(identifier, priority, data, (int)this->size());
+	this->items_->push_back(new_node);
+	this->keys_->push_back(SimdMinimum::key(priority, identifier));
+	this->heapify_up((int)this->size() - 1);
+	data_item = new_node;
+}
+
+template<typename Priority, typename Data>
+inline Data SimdHeap<Priority, Data>::pop(int& identifier)
+{
+	if (this->items_->empty())
+	{
+		throw new std::out_of_range("SimdHeap<Priority, Data>::pop(): Zoznam je prazdny");
+	}
+	ArrayItem<Priority, Data>* item = (*this->items_)[0];
+	this->fill_from_back(0);
+	Data data = item->data();
+	identifier = item->identifier();
+	this->destroy_item(item);
+	return data;
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::erase(PriorityQueueItem<Priority, Data>* node)
+{
+	this->fill_from_back(((ArrayItem<Priority, Data>*)node)->index());
+	this->destroy_item(node);
+}
+
+template<typename Priority, typename Data>
+inline Data& SimdHeap<Priority, Data>::find_min()
+{
+	if (this->items_->empty())
+	{
+		throw new std::out_of_range("SimdHeap<Priority, Data>::find_min(): Zoznam je prazdny");
+	}
+	return (*this->items_)[0]->data();
+}
+
+template<typename Priority, typename Data>
+inline PriorityQueueItem<Priority, Data>* SimdHeap<Priority, Data>::find_min_item()
+{
+	if (this->items_->empty())
+	{
+		throw new std::out_of_range("SimdHeap<Priority, Data>::find_min_item(): Zoznam je prazdny");
+	}
+	return (*this->items_)[0];
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::merge(PriorityQueue<Priority, Data>* other_heap)
+{
+	SimdHeap<Priority, Data>* heap = (SimdHeap<Priority, Data>*)other_heap;
+	for (size_t i = 0; i < heap->size(); i++)
+	{
+		ArrayItem<Priority, Data>* item = (*heap->items_)[i];
+		item->index() = (int)this->size();
+		this->items_->push_back(item);
+		this->keys_->push_back((*heap->keys_)[i]);
+		this->heapify_up(item->index());
+	}
+	heap->items_->clear();
+	heap->keys_->clear();
+	delete heap;
+}
+
+template<typename Priority, typename Data>
+inline int SimdHeap<Priority, Data>::min_son(const int index)
+{
+	int first_son = ARITY * index + 1;
+	int size = (int)this->size();
+	const long long* keys = this->keys_->data();
+	if (first_son + ARITY <= size)
+	{
+		return first_son + SimdMinimum::min_of_four(keys + first_son, this->level_);
+	}
+	int minimum = first_son;
+	for (int son = first_son + 1; son < size; son++)
+	{
+		if (keys[son] < keys[minimum])
+		{
+			minimum = son;
+		}
+	}
+	return minimum;
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::place(const int index, const long long key, ArrayItem<Priority, Data>* item)
+{
+	(*this->keys_)[index] = key;
+	(*this->items_)[index] = item;
+	item->index() = index;
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::heapify_up(const int index)
+{
+	long long item_key = (*this->keys_)[index];
+	ArrayItem<Priority, Data>* item = (*this->items_)[index];
+	int i = index;
+	for (int parent = (i - 1) / ARITY; i > 0 && item_key < (*this->keys_)[parent]; i = parent, parent = (i - 1) / ARITY)
+	{
+		this->place(i, (*this->keys_)[parent], (*this->items_)[parent]);
+	}
+	this->place(i, item_key, item);
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::heapify_down(const int index)
+{
+	long long item_key = (*this->keys_)[index];
+	ArrayItem<Priority, Data>* item = (*this->items_)[index];
+	int i = index;
+	for (int son = this->min_son(i); son < (int)this->size() && (*this->keys_)[son] < item_key; i = son, son = this->min_son(i))
+	{
+		this->place(i, (*this->keys_)[son], (*this->items_)[son]);
+	}
+	this->place(i, item_key, item);
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::fill_from_back(const int index)
+{
+	int last = (int)this->size() - 1;
+	long long item_key = this->keys_->back();
+	ArrayItem<Priority, Data>* item = this->items_->back();
+	this->keys_->pop_back();
+	this->items_->pop_back();
+	if (index != last)
+	{
+		this->place(index, item_key, item);
+		this->heapify_up(index);
+		this->heapify_down(item->index());
+	}
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::priority_was_increased(PriorityQueueItem<Priority, Data>* node)
+{
+	int index = ((ArrayItem<Priority, Data>*)node)->index();
+	(*this->keys_)[index] = SimdMinimum::key(node->priority(), node->identifier());
+	this->heapify_up(index);
+}
+
+template<typename Priority, typename Data>
+inline void SimdHeap<Priority, Data>::priority_was_decreased(PriorityQueueItem<Priority, Data>* node)
+{
+	int index = ((ArrayItem<Priority, Data>*)node)->index();
+	(*this->keys_)[index] = SimdMinimum::key(node->priority(), node->identifier());
+	this->heapify_down(index);
+}
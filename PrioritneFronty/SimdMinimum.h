@@ -0,0 +1,281 @@
+#pragma once
+#include <type_traits>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SIMD_MINIMUM_X86
+#define SIMD_MINIMUM_TARGET(instruction_set)
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_MINIMUM_X86
+#define SIMD_MINIMUM_TARGET(instruction_set) __attribute__((target(instruction_set)))
+#endif
+
+/// <summary>
+/// Sada vektorovch intrukci pouit pri hadan minima
+/// </summary>
+enum class SimdLevel
+{
+	/// <summary>
+	/// Bez vektorovch intrukci
+	/// </summary>
+	SCALAR,
+	/// <summary>
+	/// SSE4.2, porovnanie dvoch 64-bitovch kov naraz
+	/// </summary>
+	SSE42,
+	/// <summary>
+	/// AVX2, porovnanie tyroch 64-bitovch kov naraz
+	/// </summary>
+	AVX2
+};
+
+/// <summary>
+/// Hadanie minima v svislom zozname 64-bitovch kov, sada intrukci sa vyber za behu poda procesora
+/// </summary>
+class SimdMinimum
+{
+private:
+	/// <summary>
+	/// Zist najvyiu sadu intrukci, ktor podporuje procesor a operan systm
+	/// </summary>
+	/// <returns>Sada intrukci</returns>
+	static SimdLevel detect_level();
+#ifdef SIMD_MINIMUM_X86
+	/// <summary>
+	/// Vrti index najmenieho zo tyroch kov pomocou SSE4.2
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <returns>Index najmenieho ka</returns>
+	SIMD_MINIMUM_TARGET("sse4.2") static int min_of_four_sse42(const long long* keys);
+	/// <summary>
+	/// Vrti index najmenieho zo tyroch kov pomocou AVX2
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <returns>Index najmenieho ka</returns>
+	SIMD_MINIMUM_TARGET("avx2") static int min_of_four_avx2(const long long* keys);
+	/// <summary>
+	/// Vrti index najmenieho z count kov pomocou SSE4.2
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <param name="count">Poet kov, aspo 2</param>
+	/// <returns>Index najmenieho ka</returns>
+	SIMD_MINIMUM_TARGET("sse4.2") static int find_min_sse42(const long long* keys, const int count);
+	/// <summary>
+	/// Vrti index najmenieho z count kov pomocou AVX2
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <param name="count">Poet kov, aspo 4</param>
+	/// <returns>Index najmenieho ka</returns>
+	SIMD_MINIMUM_TARGET("avx2") static int find_min_avx2(const long long* keys, const int count);
+#endif
+	/// <summary>
+	/// Vrti index najmenieho z kov na indexoch from a count - 1, ak je men ako k na indexe minimum, inak minimum
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <param name="from">Index prvho porovnvanho ka</param>
+	/// <param name="count">Poet kov</param>
+	/// <param name="minimum">Index doteraz najmenieho ka</param>
+	/// <returns>Index najmenieho ka</returns>
+	static int find_min_scalar(const long long* keys, const int from, const int count, int minimum);
+public:
+	/// <summary>
+	/// Vrti najvyiu sadu intrukci, ktor podporuje procesor, zisuje sa len raz
+	/// </summary>
+	/// <returns>Sada intrukci</returns>
+	static SimdLevel supported_level();
+	/// <summary>
+	/// Vrti niiu z poadovanej a podporovanej sady intrukci
+	/// </summary>
+	/// <param name="level">Poadovan sada intrukci</param>
+	/// <returns>Pouiten sada intrukci</returns>
+	static SimdLevel usable_level(const SimdLevel level);
+	/// <summary>
+	/// Vrti index najmenieho zo tyroch rznych kov
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <param name="level">Pouiten sada intrukci</param>
+	/// <returns>Index najmenieho ka</returns>
+	static int min_of_four(const long long* keys, const SimdLevel level);
+	/// <summary>
+	/// Vrti index najmenieho z count rznych kov
+	/// </summary>
+	/// <param name="keys">Ke</param>
+	/// <param name="count">Poet kov, aspo 1</param>
+	/// <param name="level">Pouiten sada intrukci</param>
+	/// <returns>Index najmenieho ka</returns>
+	static int find_min(const long long* keys, const int count, const SimdLevel level);
+	/// <summary>
+	/// Vrti, i mono prioritu typu Priority spolu s identifiktorom zloi do 64-bitovho ka
+	/// </summary>
+	/// <typeparam name="Priority">Dtov typ priority</typeparam>
+	/// <returns>True pre cel sla so znamienkom, najviac 32-bitov</returns>
+	template <typename Priority>
+	static constexpr bool has_key();
+	/// <summary>
+	/// Vrti 64-bitov k, ktorho usporiadanie zodpoved usporiadaniu prvkov poda priority a identifiktora
+	/// </summary>
+	/// <typeparam name="Priority">Dtov typ priority, pre ktor has_key() vrti true</typeparam>
+	/// <param name="priority">Priorita</param>
+	/// <param name="identifier">Identifiktor</param>
+	/// <returns>K</returns>
+	template <typename Priority>
+	static long long key(const Priority& priority, const int identifier);
+};
+
+inline SimdLevel SimdMinimum::detect_level()
+{
+#if defined(SIMD_MINIMUM_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int leaf_count = info[0];
+	__cpuid(info, 1);
+	bool sse42 = (info[2] & (1 << 20)) != 0;
+	bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+	bool avx2 = false;
+	if (avx && leaf_count >= 7)
+	{
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+	return avx2 ? SimdLevel::AVX2 : sse42 ? SimdLevel::SSE42 : SimdLevel::SCALAR;
+#elif defined(SIMD_MINIMUM_X86)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : __builtin_cpu_supports("sse4.2") ? SimdLevel::SSE42 : SimdLevel::SCALAR;
+#else
+	return SimdLevel::SCALAR;
+#endif
+}
+
+inline SimdLevel SimdMinimum::supported_level()
+{
+	static const SimdLevel level = detect_level();
+	return level;
+}
+
+inline SimdLevel SimdMinimum::usable_level(const SimdLevel level)
+{
+	return level < supported_level() ? level : supported_level();
+}
+
+inline int SimdMinimum::find_min_scalar(const long long* keys, const int from, const int count, int minimum)
+{
+	for (int i = from; i < count; i++)
+	{
+		if (keys[i] < keys[minimum])
+		{
+			minimum = i;
+		}
+	}
+	return minimum;
+}
+
+#ifdef SIMD_MINIMUM_X86
+SIMD_MINIMUM_TARGET("sse4.2") inline int SimdMinimum::min_of_four_sse42(const long long* keys)
+{
+	__m128i low = _mm_loadu_si128((const __m128i*)keys);
+	__m128i high = _mm_loadu_si128((const __m128i*)(keys + 2));
+	__m128i greater = _mm_cmpgt_epi64(low, high);
+	__m128i minimum = _mm_blendv_epi8(low, high, greater);
+	__m128i index = _mm_blendv_epi8(_mm_set_epi64x(1, 0), _mm_set_epi64x(3, 2), greater);
+	greater = _mm_cmpgt_epi64(minimum, _mm_unpackhi_epi64(minimum, minimum));
+	index = _mm_blendv_epi8(index, _mm_unpackhi_epi64(index, index), greater);
+	return _mm_cvtsi128_si32(index);
+}
+
+SIMD_MINIMUM_TARGET("avx2") inline int SimdMinimum::min_of_four_avx2(const long long* keys)
+{
+	__m256i keys_vector = _mm256_loadu_si256((const __m256i*)keys);
+	__m256i swapped = _mm256_permute4x64_epi64(keys_vector, 0x4E);
+	__m256i greater = _mm256_cmpgt_epi64(keys_vector, swapped);
+	__m256i minimum = _mm256_blendv_epi8(keys_vector, swapped, greater);
+	__m256i index = _mm256_blendv_epi8(_mm256_set_epi64x(3, 2, 1, 0), _mm256_set_epi64x(1, 0, 3, 2), greater);
+	greater = _mm256_cmpgt_epi64(minimum, _mm256_shuffle_epi32(minimum, 0x4E));
+	index = _mm256_blendv_epi8(index, _mm256_shuffle_epi32(index, 0x4E), greater);
+	return _mm_cvtsi128_si32(_mm256_castsi256_si128(index));
+}
+
+SIMD_MINIMUM_TARGET("sse4.2") inline int SimdMinimum::find_min_sse42(const long long* keys, const int count)
+{
+	__m128i minimum = _mm_loadu_si128((const __m128i*)keys);
+	__m128i index = _mm_set_epi64x(1, 0), current = index;
+	const __m128i step = _mm_set1_epi64x(2);
+	int i = 2;
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128i candidate = _mm_loadu_si128((const __m128i*)(keys + i));
+		current = _mm_add_epi64(current, step);
+		__m128i greater = _mm_cmpgt_epi64(minimum, candidate);
+		minimum = _mm_blendv_epi8(minimum, candidate, greater);
+		index = _mm_blendv_epi8(index, current, greater);
+	}
+	__m128i greater = _mm_cmpgt_epi64(minimum, _mm_unpackhi_epi64(minimum, minimum));
+	index = _mm_blendv_epi8(index, _mm_unpackhi_epi64(index, index), greater);
+	return find_min_scalar(keys, i, count, _mm_cvtsi128_si32(index));
+}
+
+SIMD_MINIMUM_TARGET("avx2") inline int SimdMinimum::find_min_avx2(const long long* keys, const int count)
+{
+	__m256i minimum = _mm256_loadu_si256((const __m256i*)keys);
+	__m256i index = _mm256_set_epi64x(3, 2, 1, 0), current = index;
+	const __m256i step = _mm256_set1_epi64x(4);
+	int i = 4;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256i candidate = _mm256_loadu_si256((const __m256i*)(keys + i));
+		current = _mm256_add_epi64(current, step);
+		__m256i greater = _mm256_cmpgt_epi64(minimum, candidate);
+		minimum = _mm256_blendv_epi8(minimum, candidate, greater);
+		index = _mm256_blendv_epi8(index, current, greater);
+	}
+	__m256i swapped = _mm256_permute4x64_epi64(minimum, 0x4E);
+	__m256i greater = _mm256_cmpgt_epi64(minimum, swapped);
+	minimum = _mm256_blendv_epi8(minimum, swapped, greater);
+	index = _mm256_blendv_epi8(index, _mm256_permute4x64_epi64(index, 0x4E), greater);
+	greater = _mm256_cmpgt_epi64(minimum, _mm256_shuffle_epi32(minimum, 0x4E));
+	index = _mm256_blendv_epi8(index, _mm256_shuffle_epi32(index, 0x4E), greater);
+	return find_min_scalar(keys, i, count, _mm_cvtsi128_si32(_mm256_castsi256_si128(index)));
+}
+#endif
+
+inline int SimdMinimum::min_of_four(const long long* keys, const SimdLevel level)
+{
+#ifdef SIMD_MINIMUM_X86
+	switch (level)
+	{
+	case SimdLevel::AVX2:
+		return min_of_four_avx2(keys);
+	case SimdLevel::SSE42:
+		return min_of_four_sse42(keys);
+	default:
+		break;
+	}
+#endif
+	return find_min_scalar(keys, 1, 4, 0);
+}
+
+inline int SimdMinimum::find_min(const long long* keys, const int count, const SimdLevel level)
+{
+#ifdef SIMD_MINIMUM_X86
+	if (level == SimdLevel::AVX2 && count >= 4)
+	{
+		return find_min_avx2(keys, count);
+	}
+	if (level != SimdLevel::SCALAR && count >= 2)
+	{
+		return find_min_sse42(keys, count);
+	}
+#endif
+	return find_min_scalar(keys, 1, count, 0);
+}
+
+template <typename Priority>
+inline constexpr bool SimdMinimum::has_key()
+{
+	return std::is_integral<Priority>::value && std::is_signed<Priority>::value && sizeof(Priority) <= sizeof(int);
+}
+
+template <typename Priority>
+inline long long SimdMinimum::key(const Priority& priority, const int identifier)
+{
+	return (long long)(((unsigned long long)(long long)priority << 32) | ((unsigned int)identifier ^ 0x80000000u));
+}
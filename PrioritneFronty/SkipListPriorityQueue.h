@@ -0,0 +1,437 @@
+#pragma once
+#include "ConcurrentPriorityQueue.h"
+#include <atomic>
+#include <random>
+
+/// <summary>
+/// Sben prioritn front bez zmkov implementovan skip listom poda Lindn a Jonsson (2013)
+/// Vber minima logicky odstrni prvok oznaenm smernka predchodcu, odstrnen prvky tvoria prefix zoznamu,
+/// ktor sa fyzicky odpoj naraz a po prekroen hranice bound_offset
+/// Odpojen prvky sa dealokuj pomocou epoch, prvok odpojen v epoche e sa uvon po posune do epochy e + 2,
+/// ke u neprebieha iadna opercia, ktor zaala pred jeho odpojenm
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Data">Dtov typ dt</typeparam>
+template <typename Priority, typename Data>
+class SkipListPriorityQueue : public ConcurrentPriorityQueue<Priority, Data>
+{
+private:
+	/// <summary>
+	/// Maximlny poet rovn
+	/// </summary>
+	static const int MAX_LEVEL = 24;
+	/// <summary>
+	/// Poet sasne rozlench epoch
+	/// </summary>
+	static const int EPOCH_COUNT = 3;
+	/// <summary>
+	/// Zarky na zaiatku a konci zoznamu
+	/// </summary>
+	SkipListItem<Priority, Data>* head_, * tail_;
+	/// <summary>
+	/// Dka prefixu odstrnench prvkov, po ktorej sa prefix fyzicky odpoj
+	/// </summary>
+	int bound_offset_;
+	/// <summary>
+	/// Aktulna epocha
+	/// </summary>
+	std::atomic<unsigned long long> epoch_;
+	/// <summary>
+	/// Poty prebiehajcich operci poda epochy, v ktorej zaali
+	/// </summary>
+	std::atomic<long long> active_[EPOCH_COUNT];
+	/// <summary>
+	/// Zsobnky odpojench prvkov poda epochy odpojenia, prvky mu ete ta opercie, ktor zaali pred odpojenm
+	/// </summary>
+	std::atomic<SkipListItem<Priority, Data>*> retired_[EPOCH_COUNT];
+	/// <summary>
+	/// Vrti, i je smernk oznaen
+	/// </summary>
+	/// <param name="link">Smernk</param>
+	/// <returns>True, ak je nasledovnk logicky odstrnen</returns>
+	static bool is_marked(const uintptr_t link);
+	/// <summary>
+	/// Vrti prvok, na ktor ukazuje smernk bez oznaenia
+	/// </summary>
+	/// <param name="link">Smernk</param>
+	/// <returns>Prvok</returns>
+	static SkipListItem<Priority, Data>* unmarked(const uintptr_t link);
+	/// <summary>
+	/// Vrti oznaen smernk na prvok
+	/// </summary>
+	/// <param name="node">Prvok</param>
+	/// <returns>Oznaen smernk</returns>
+	static uintptr_t marked(SkipListItem<Priority, Data>* node);
+	/// <summary>
+	/// Vrti nhodn poet rovn novho prvku
+	/// </summary>
+	/// <returns>Poet rovn</returns>
+	static int random_level();
+	/// <summary>
+	/// Vrti, i prvok node predchdza prvku s prioritou priority a identifiktorom identifier
+	/// </summary>
+	/// <param name="node">Prvok</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="identifier">Identifiktor</param>
+	/// <returns>True, ak m prvok vyiu prioritu</returns>
+	bool precedes(SkipListItem<Priority, Data>* node, const Priority& priority, const int identifier);
+	/// <summary>
+	/// Njde na kadej rovni posledn prvok pred miestom vloenia a prv prvok za nm, priom presko odstrnen prvky
+	/// </summary>
+	/// <param name="priority">Priorita</param>
+	/// <param name="identifier">Identifiktor</param>
+	/// <param name="predecessors">Predchodcovia na jednotlivch rovniach</param>
+	/// <param name="successors">Nasledovnci na jednotlivch rovniach</param>
+	/// <returns>Posledn odstrnen prvok preskoen na rovni 0</returns>
+	SkipListItem<Priority, Data>* locate_predecessors(const Priority& priority, const int identifier, SkipListItem<Priority, Data>** predecessors, SkipListItem<Priority, Data>** successors);
+	/// <summary>
+	/// Presmeruje vyie rovne zarky za odstrnen prefix
+	/// </summary>
+	void restructure();
+	/// <summary>
+	/// Zaznamen zaiatok opercie v aktulnej epoche
+	/// </summary>
+	/// <returns>Epocha, v ktorej opercia zaala</returns>
+	unsigned long long enter();
+	/// <summary>
+	/// Zaznamen koniec opercie
+	/// </summary>
+	/// <param name="epoch">Epocha, v ktorej opercia zaala</param>
+	void leave(const unsigned long long epoch);
+	/// <summary>
+	/// Vlo odpojen prvok do zsobnka prvkov akajcich na dealokciu
+	/// </summary>
+	/// <param name="node">Odpojen prvok</param>
+	/// <param name="epoch">Epocha, v ktorej bol prvok odpojen</param>
+	void retire(SkipListItem<Priority, Data>* node, const unsigned long long epoch);
+	/// <summary>
+	/// Posunie epochu, ak u neprebieha iadna opercia z predchdzajcej epochy, a dealokuje prvky odpojen pred dvoma epochami
+	/// </summary>
+	void advance_epoch();
+	/// <summary>
+	/// Dealokuje zsobnk odpojench prvkov
+	/// </summary>
+	/// <param name="node">Vrchol zsobnka</param>
+	static void reclaim(SkipListItem<Priority, Data>* node);
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="bound_offset">Dka prefixu odstrnench prvkov, po ktorej sa prefix fyzicky odpoj</param>
+	SkipListPriorityQueue(const int bound_offset = 32);
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~SkipListPriorityQueue();
+	/// <summary>
+	/// Vyme vetky prvky z prioritnho frontu a dealokuje odpojen prvky, nesmie prebieha sasne s inmi operciami
+	/// </summary>
+	void clear() override;
+	/// <summary>
+	/// Vlo dta do prioritnho frontu
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	/// <param name="priority">Priorita</param>
+	/// <param name="data">Data</param>
+	void push(const int identifier, const Priority& priority, const Data& data) override;
+	/// <summary>
+	/// Vyberie z prioritnho frontu dta s najvou prioritou, ak nie je przdny
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku s najvou prioritou</param>
+	/// <param name="data">Hodnota dt</param>
+	/// <returns>True, ak bol prvok vybran</returns>
+	bool try_pop(int& identifier, Data& data) override;
+};
+
+template<typename Priority, typename Data>
+inline SkipListPriorityQueue<Priority, Data>::SkipListPriorityQueue(const int bound_offset) :
+	ConcurrentPriorityQueue<Priority, Data>(),
+	head_(new SkipListItem<Priority, Data>(0, Priority(), Data(), MAX_LEVEL)),
+	tail_(new SkipListItem<Priority, Data>(0, Priority(), Data(), MAX_LEVEL)),
+	bound_offset_(bound_offset),
+	epoch_(0)
+{
+	for (int i = 0; i < EPOCH_COUNT; i++)
+	{
+		this->active_[i].store(0);
+		this->retired_[i].store(nullptr);
+	}
+	this->head_->inserting().store(false);
+	this->tail_->inserting().store(false);
+	for (int i = 0; i < MAX_LEVEL; i++)
+	{
+		this->head_->next(i).store((uintptr_t)this->tail_);
+	}
+}
+
+template<typename Priority, typename Data>
+inline SkipListPriorityQueue<Priority, Data>::~SkipListPriorityQueue()
+{
+	this->clear();
+	delete this->head_;
+	delete this->tail_;
+	this->head_ = nullptr;
+	this->tail_ = nullptr;
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::clear()
+{
+	SkipListItem<Priority, Data>* node = unmarked(this->head_->next(0).load());
+	while (node != this->tail_)
+	{
+		SkipListItem<Priority, Data>* next = unmarked(node->next(0).load());
+		delete node;
+		node = next;
+	}
+	for (int i = 0; i < EPOCH_COUNT; i++)
+	{
+		reclaim(this->retired_[i].exchange(nullptr));
+	}
+	for (int i = 0; i < MAX_LEVEL; i++)
+	{
+		this->head_->next(i).store((uintptr_t)this->tail_);
+	}
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::push(const int identifier, const Priority& priority, const Data& data)
+{
+	SkipListItem<Priority, Data>* predecessors[MAX_LEVEL], * successors[MAX_LEVEL];
+	SkipListItem<Priority, Data>* new_node = new SkipListItem<Priority, Data>(identifier, priority, data, random_level());
+	SkipListItem<Priority, Data>* deleted;
+	uintptr_t expected;
+	unsigned long long epoch = this->enter();
+	do
+	{
+		deleted = this->locate_predecessors(priority, identifier, predecessors, successors);
+		new_node->next(0).store((uintptr_t)successors[0]);
+		expected = (uintptr_t)successors[0];
+	} while (!predecessors[0]->next(0).compare_exchange_strong(expected, (uintptr_t)new_node));
+
+	for (int i = 1; i < new_node->level(); )
+	{
+		if (is_marked(new_node->next(0).load()) || is_marked(successors[i]->next(0).load()) || successors[i] == deleted)
+		{
+			break;
+		}
+		new_node->next(i).store((uintptr_t)successors[i]);
+		expected = (uintptr_t)successors[i];
+		if (predecessors[i]->next(i).compare_exchange_strong(expected, (uintptr_t)new_node))
+		{
+			i++;
+		}
+		else
+		{
+			deleted = this->locate_predecessors(priority, identifier, predecessors, successors);
+			if (successors[0] != new_node)
+			{
+				break;
+			}
+		}
+	}
+	new_node->inserting().store(false);
+	this->leave(epoch);
+}
+
+template<typename Priority, typename Data>
+inline bool SkipListPriorityQueue<Priority, Data>::try_pop(int& identifier, Data& data)
+{
+	unsigned long long epoch = this->enter();
+	SkipListItem<Priority, Data>* node = this->head_, * new_head = nullptr;
+	uintptr_t observed_head = this->head_->next(0).load(), link;
+	int offset = 0;
+	do
+	{
+		link = node->next(0).load();
+		if (unmarked(link) == this->tail_)
+		{
+			this->leave(epoch);
+			return false;
+		}
+		if (new_head == nullptr && node->inserting().load())
+		{
+			new_head = node;
+		}
+		if (!is_marked(link))
+		{
+			link = node->next(0).fetch_or(1);
+		}
+		offset++;
+		node = unmarked(link);
+	} while (is_marked(link));
+
+	identifier = node->identifier();
+	data = node->data();
+	if (offset < this->bound_offset_)
+	{
+		this->leave(epoch);
+		return true;
+	}
+	if (new_head == nullptr)
+	{
+		new_head = node;
+	}
+	bool retired = this->head_->next(0).compare_exchange_strong(observed_head, marked(new_head));
+	if (retired)
+	{
+		this->restructure();
+		unsigned long long retire_epoch = this->epoch_.load();
+		SkipListItem<Priority, Data>* retired_node = unmarked(observed_head);
+		while (retired_node != new_head)
+		{
+			SkipListItem<Priority, Data>* next = unmarked(retired_node->next(0).load());
+			this->retire(retired_node, retire_epoch);
+			retired_node = next;
+		}
+	}
+	this->leave(epoch);
+	if (retired)
+	{
+		this->advance_epoch();
+	}
+	return true;
+}
+
+template<typename Priority, typename Data>
+inline bool SkipListPriorityQueue<Priority, Data>::is_marked(const uintptr_t link)
+{
+	return (link & 1) != 0;
+}
+
+template<typename Priority, typename Data>
+inline SkipListItem<Priority, Data>* SkipListPriorityQueue<Priority, Data>::unmarked(const uintptr_t link)
+{
+	return (SkipListItem<Priority, Data>*)(link & ~(uintptr_t)1);
+}
+
+template<typename Priority, typename Data>
+inline uintptr_t SkipListPriorityQueue<Priority, Data>::marked(SkipListItem<Priority, Data>* node)
+{
+	return (uintptr_t)node | 1;
+}
+
+template<typename Priority, typename Data>
+inline int SkipListPriorityQueue<Priority, Data>::random_level()
+{
+	static thread_local std::mt19937 generator(std::random_device{}());
+	unsigned int bits = generator();
+	int level = 1;
+	while ((bits & 1) != 0 && level < MAX_LEVEL)
+	{
+		level++;
+		bits >>= 1;
+	}
+	return level;
+}
+
+template<typename Priority, typename Data>
+inline bool SkipListPriorityQueue<Priority, Data>::precedes(SkipListItem<Priority, Data>* node, const Priority& priority, const int identifier)
+{
+	if (node == this->tail_)
+	{
+		return false;
+	}
+	return node->priority() < priority || (node->priority() == priority && node->identifier() < identifier);
+}
+
+template<typename Priority, typename Data>
+inline SkipListItem<Priority, Data>* SkipListPriorityQueue<Priority, Data>::locate_predecessors(const Priority& priority, const int identifier, SkipListItem<Priority, Data>** predecessors, SkipListItem<Priority, Data>** successors)
+{
+	SkipListItem<Priority, Data>* predecessor = this->head_, * deleted = nullptr;
+	for (int i = MAX_LEVEL - 1; i >= 0; i--)
+	{
+		uintptr_t link = predecessor->next(i).load();
+		SkipListItem<Priority, Data>* current = unmarked(link);
+		while (current != this->tail_ && (this->precedes(current, priority, identifier) || is_marked(current->next(0).load()) || (i == 0 && is_marked(link))))
+		{
+			if (i == 0 && is_marked(link))
+			{
+				deleted = current;
+			}
+			predecessor = current;
+			link = predecessor->next(i).load();
+			current = unmarked(link);
+		}
+		predecessors[i] = predecessor;
+		successors[i] = current;
+	}
+	return deleted;
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::restructure()
+{
+	SkipListItem<Priority, Data>* predecessor = this->head_;
+	for (int i = MAX_LEVEL - 1; i > 0; )
+	{
+		uintptr_t head_link = this->head_->next(i).load();
+		if (unmarked(head_link) == this->tail_ || !is_marked(unmarked(head_link)->next(0).load()))
+		{
+			i--;
+			continue;
+		}
+		SkipListItem<Priority, Data>* current = unmarked(predecessor->next(i).load());
+		while (current != this->tail_ && is_marked(current->next(0).load()))
+		{
+			predecessor = current;
+			current = unmarked(predecessor->next(i).load());
+		}
+		if (this->head_->next(i).compare_exchange_strong(head_link, (uintptr_t)current))
+		{
+			i--;
+		}
+	}
+}
+
+template<typename Priority, typename Data>
+inline unsigned long long SkipListPriorityQueue<Priority, Data>::enter()
+{
+	unsigned long long epoch = this->epoch_.load();
+	this->active_[epoch % EPOCH_COUNT].fetch_add(1);
+	while (this->epoch_.load() != epoch)
+	{
+		this->active_[epoch % EPOCH_COUNT].fetch_sub(1);
+		epoch = this->epoch_.load();
+		this->active_[epoch % EPOCH_COUNT].fetch_add(1);
+	}
+	return epoch;
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::leave(const unsigned long long epoch)
+{
+	this->active_[epoch % EPOCH_COUNT].fetch_sub(1);
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::retire(SkipListItem<Priority, Data>* node, const unsigned long long epoch)
+{
+	std::atomic<SkipListItem<Priority, Data>*>& retired = this->retired_[epoch % EPOCH_COUNT];
+	SkipListItem<Priority, Data>* top = retired.load();
+	do
+	{
+		node->retired_next() = top;
+	} while (!retired.compare_exchange_weak(top, node));
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::advance_epoch()
+{
+	unsigned long long epoch = this->epoch_.load();
+	if (this->active_[(epoch + EPOCH_COUNT - 1) % EPOCH_COUNT].load() == 0 && this->epoch_.compare_exchange_strong(epoch, epoch + 1))
+	{
+		reclaim(this->retired_[(epoch + EPOCH_COUNT - 1) % EPOCH_COUNT].exchange(nullptr));
+	}
+}
+
+template<typename Priority, typename Data>
+inline void SkipListPriorityQueue<Priority, Data>::reclaim(SkipListItem<Priority, Data>* node)
+{
+	while (node != nullptr)
+	{
+		SkipListItem<Priority, Data>* next = node->retired_next();
+		delete node;
+		node = next;
+	}
+}
@@ -0,0 +1,490 @@
+#pragma once
+#include "PairingHeap.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// loha naplnovan v plnovai loh
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+template <typename Priority>
+class ScheduledTask
+{
+private:
+	/// <summary>
+	/// Vykonvan funkcia
+	/// </summary>
+	std::function<void()> function_;
+	/// <summary>
+	/// Prvok lohy v prioritnom fronte pracovnka
+	/// </summary>
+	PriorityQueueItem<Priority, ScheduledTask*>* node_;
+	/// <summary>
+	/// Index pracovnka, v ktorho prioritnom fronte je loha, -1 ak u bola vybran na vykonanie
+	/// </summary>
+	std::atomic<int> worker_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="function">Vykonvan funkcia</param>
+	ScheduledTask(const std::function<void()>& function);
+	/// <summary>
+	/// Getter atribtu function_
+	/// </summary>
+	/// <returns>Vykonvan funkcia</returns>
+	std::function<void()>& function();
+	/// <summary>
+	/// Getter atribtu node_
+	/// </summary>
+	/// <returns>Prvok lohy v prioritnom fronte</returns>
+	PriorityQueueItem<Priority, ScheduledTask*>*& node();
+	/// <summary>
+	/// Getter atribtu worker_
+	/// </summary>
+	/// <returns>Index pracovnka</returns>
+	std::atomic<int>& worker();
+};
+
+/// <summary>
+/// Pracovnk plnovaa loh s vlastnm prioritnm frontom chrnenm zmkom
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Heap">Prioritn front pracovnka</typeparam>
+template <typename Priority, template <typename, typename> class Heap>
+class alignas(64) TaskSchedulerWorker
+{
+private:
+	/// <summary>
+	/// Prioritn front loh pracovnka
+	/// </summary>
+	Heap<Priority, ScheduledTask<Priority>*>* heap_;
+	/// <summary>
+	/// Zmok chrniaci prioritn front
+	/// </summary>
+	std::mutex mutex_;
+	/// <summary>
+	/// Poet loh v prioritnom fronte, itaten bez uzamknutia
+	/// </summary>
+	std::atomic<size_t> size_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	TaskSchedulerWorker();
+	/// <summary>
+	/// Detruktor
+	/// </summary>
+	~TaskSchedulerWorker();
+	/// <summary>
+	/// Getter atribtu heap_, pracovnk mus by uzamknut
+	/// </summary>
+	/// <returns>Prioritn front loh</returns>
+	Heap<Priority, ScheduledTask<Priority>*>*& heap();
+	/// <summary>
+	/// Getter atribtu mutex_
+	/// </summary>
+	/// <returns>Zmok pracovnka</returns>
+	std::mutex& mutex();
+	/// <summary>
+	/// Vrti poet loh bez uzamknutia
+	/// </summary>
+	/// <returns>Poet loh</returns>
+	size_t size() const;
+	/// <summary>
+	/// Zverejn poet loh po zmene prioritnho frontu, pracovnk mus by uzamknut
+	/// </summary>
+	void publish_size();
+};
+
+/// <summary>
+/// Plnova loh poda priority, v ktorom m kad pracovnk vlastn prioritn front
+/// Neinn pracovnk ukradne lepiu polovicu loh nhodnej obete a pripoj ich k svojmu frontu operciou merge
+/// </summary>
+/// <typeparam name="Priority">Dtov typ priority</typeparam>
+/// <typeparam name="Heap">Prioritn front pracovnka</typeparam>
+template <typename Priority, template <typename, typename> class Heap = PairingHeapTwoPass>
+class TaskScheduler
+{
+private:
+	/// <summary>
+	/// Pracovnci
+	/// </summary>
+	std::vector<TaskSchedulerWorker<Priority, Heap>*>* workers_;
+	/// <summary>
+	/// Vlkna pracovnkov
+	/// </summary>
+	std::vector<std::thread>* threads_;
+	/// <summary>
+	/// lohy akajce na vykonanie poda identifiktora
+	/// </summary>
+	std::unordered_map<int, ScheduledTask<Priority>*>* tasks_;
+	/// <summary>
+	/// Zmok chrniaci tabuku loh, mus sa zamyka pred zmkom pracovnka
+	/// </summary>
+	std::mutex* tasks_mutex_;
+	/// <summary>
+	/// Zmok a podmienka, na ktorej akaj neinn pracovnci a wait_idle
+	/// </summary>
+	std::mutex* idle_mutex_;
+	std::condition_variable* idle_condition_;
+	/// <summary>
+	/// Identifiktor alej lohy
+	/// </summary>
+	std::atomic<int> next_identifier_;
+	/// <summary>
+	/// Poet odoslanch a ete nedokonench loh
+	/// </summary>
+	std::atomic<long long> pending_count_;
+	/// <summary>
+	/// Poet krde
+	/// </summary>
+	std::atomic<long long> steal_count_;
+	/// <summary>
+	/// Prznak ukonenia pracovnkov
+	/// </summary>
+	std::atomic<bool> stop_;
+	/// <summary>
+	/// Vrti index pracovnka, ktor je aktulnym vlknom, -1 ak vlkno nie je pracovnkom tohto plnovaa
+	/// </summary>
+	/// <param name="worker_index">Ak nie je -1, nastav aktulne vlkno ako pracovnka s tmto indexom</param>
+	/// <returns>Index pracovnka</returns>
+	int current_worker(const int worker_index = -1);
+	/// <summary>
+	/// Cyklus pracovnka
+	/// </summary>
+	/// <param name="worker_index">Index pracovnka</param>
+	void work(const int worker_index);
+	/// <summary>
+	/// Vyberie z frontu pracovnka lohu s najvou prioritou
+	/// </summary>
+	/// <param name="worker_index">Index pracovnka</param>
+	/// <returns>loha, nullptr ak je front przdny</returns>
+	ScheduledTask<Priority>* pop(const int worker_index);
+	/// <summary>
+	/// Presunie lepiu polovicu loh prvej neprzdnej obete k zlodejovi
+	/// </summary>
+	/// <param name="thief_index">Index pracovnka, ktor kradne</param>
+	/// <returns>True, ak boli nejak lohy ukradnut</returns>
+	bool steal(const int thief_index);
+public:
+	/// <summary>
+	/// Kontruktor, spust pracovnkov
+	/// </summary>
+	/// <param name="worker_count">Poet pracovnkov</param>
+	TaskScheduler(const int worker_count);
+	/// <summary>
+	/// Detruktor, pok na dokonenie vetkch loh a ukon pracovnkov
+	/// </summary>
+	~TaskScheduler();
+	/// <summary>
+	/// Naplnuje lohu, z pracovnka do jeho vlastnho frontu, inak do frontu pracovnka vybranho cyklicky
+	/// </summary>
+	/// <param name="priority">Priorita lohy</param>
+	/// <param name="function">Vykonvan funkcia</param>
+	/// <returns>Identifiktor lohy</returns>
+	int submit(const Priority& priority, const std::function<void()>& function);
+	/// <summary>
+	/// Zmen prioritu akajcej lohy
+	/// </summary>
+	/// <param name="identifier">Identifiktor lohy</param>
+	/// <param name="priority">Nov priorita</param>
+	/// <returns>True, ak loha ete akala na vykonanie</returns>
+	bool reprioritize(const int identifier, const Priority& priority);
+	/// <summary>
+	/// Pok, km nie s dokonen vetky naplnovan lohy
+	/// </summary>
+	void wait_idle();
+	/// <summary>
+	/// Vrti poet krde od vytvorenia plnovaa
+	/// </summary>
+	/// <returns>Poet krde</returns>
+	long long steal_count() const;
+};
+
+template<typename Priority>
+inline ScheduledTask<Priority>::ScheduledTask(const std::function<void()>& function) :
+	function_(function), node_(nullptr), worker_(-1)
+{
+}
+
+template<typename Priority>
+inline std::function<void()>& ScheduledTask<Priority>::function()
+{
+	return this->function_;
+}
+
+template<typename Priority>
+inline PriorityQueueItem<Priority, ScheduledTask<Priority>*>*& ScheduledTask<Priority>::node()
+{
+	return this->node_;
+}
+
+template<typename Priority>
+inline std::atomic<int>& ScheduledTask<Priority>::worker()
+{
+	return this->worker_;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline TaskSchedulerWorker<Priority, Heap>::TaskSchedulerWorker() :
+	heap_(new Heap<Priority, ScheduledTask<Priority>*>()),
+	size_(0)
+{
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline TaskSchedulerWorker<Priority, Heap>::~TaskSchedulerWorker()
+{
+	delete this->heap_;
+	this->heap_ = nullptr;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline Heap<Priority, ScheduledTask<Priority>*>*& TaskSchedulerWorker<Priority, Heap>::heap()
+{
+	return this->heap_;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline std::mutex& TaskSchedulerWorker<Priority, Heap>::mutex()
+{
+	return this->mutex_;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline size_t TaskSchedulerWorker<Priority, Heap>::size() const
+{
+	return this->size_.load(std::memory_order_relaxed);
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline void TaskSchedulerWorker<Priority, Heap>::publish_size()
+{
+	this->size_.store(this->heap_->size(), std::memory_order_relaxed);
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline TaskScheduler<Priority, Heap>::TaskScheduler(const int worker_count) :
+	workers_(new std::vector<TaskSchedulerWorker<Priority, Heap>*>()),
+	threads_(new std::vector<std::thread>()),
+	tasks_(new std::unordered_map<int, ScheduledTask<Priority>*>()),
+	tasks_mutex_(new std::mutex()),
+	idle_mutex_(new std::mutex()),
+	idle_condition_(new std::condition_variable()),
+	next_identifier_(0),
+	pending_count_(0),
+	steal_count_(0),
+	stop_(false)
+{
+	for (int i = 0; i < std::max(worker_count, 1); i++)
+	{
+		this->workers_->push_back(new TaskSchedulerWorker<Priority, Heap>());
+	}
+	for (int i = 0; i < (int)this->workers_->size(); i++)
+	{
+		this->threads_->emplace_back(&TaskScheduler<Priority, Heap>::work, this, i);
+	}
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline TaskScheduler<Priority, Heap>::~TaskScheduler()
+{
+	this->wait_idle();
+	this->stop_.store(true);
+	this->idle_condition_->notify_all();
+	for (std::thread& thread : *this->threads_)
+	{
+		thread.join();
+	}
+	for (TaskSchedulerWorker<Priority, Heap>* worker : *this->workers_)
+	{
+		delete worker;
+	}
+	delete this->workers_;
+	delete this->threads_;
+	delete this->tasks_;
+	delete this->tasks_mutex_;
+	delete this->idle_mutex_;
+	delete this->idle_condition_;
+	this->workers_ = nullptr;
+	this->threads_ = nullptr;
+	this->tasks_ = nullptr;
+	this->tasks_mutex_ = nullptr;
+	this->idle_mutex_ = nullptr;
+	this->idle_condition_ = nullptr;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline int TaskScheduler<Priority, Heap>::submit(const Priority& priority, const std::function<void()>& function)
+{
+	int identifier = this->next_identifier_.fetch_add(1, std::memory_order_relaxed);
+	int worker_index = this->current_worker();
+	if (worker_index < 0)
+	{
+		worker_index = identifier % (int)this->workers_->size();
+	}
+	ScheduledTask<Priority>* task = new ScheduledTask<Priority>(function);
+	TaskSchedulerWorker<Priority, Heap>* worker = (*this->workers_)[worker_index];
+	this->pending_count_.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> tasks_lock(*this->tasks_mutex_);
+		(*this->tasks_)[identifier] = task;
+		std::lock_guard<std::mutex> worker_lock(worker->mutex());
+		worker->heap()->push(identifier, priority, task, task->node());
+		task->worker().store(worker_index);
+		worker->publish_size();
+	}
+	this->idle_condition_->notify_one();
+	return identifier;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline bool TaskScheduler<Priority, Heap>::reprioritize(const int identifier, const Priority& priority)
+{
+	std::lock_guard<std::mutex> tasks_lock(*this->tasks_mutex_);
+	typename std::unordered_map<int, ScheduledTask<Priority>*>::iterator iterator = this->tasks_->find(identifier);
+	if (iterator == this->tasks_->end())
+	{
+		return false;
+	}
+	ScheduledTask<Priority>* task = iterator->second;
+	for (int worker_index = task->worker().load(); worker_index >= 0; worker_index = task->worker().load())
+	{
+		TaskSchedulerWorker<Priority, Heap>* worker = (*this->workers_)[worker_index];
+		std::lock_guard<std::mutex> worker_lock(worker->mutex());
+		if (task->worker().load() == worker_index)
+		{
+			worker->heap()->change_priority(task->node(), priority);
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline void TaskScheduler<Priority, Heap>::wait_idle()
+{
+	std::unique_lock<std::mutex> lock(*this->idle_mutex_);
+	this->idle_condition_->wait(lock, [this]() { return this->pending_count_.load() == 0; });
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline long long TaskScheduler<Priority, Heap>::steal_count() const
+{
+	return this->steal_count_.load();
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline int TaskScheduler<Priority, Heap>::current_worker(const int worker_index)
+{
+	static thread_local const void* scheduler = nullptr;
+	static thread_local int index = -1;
+	if (worker_index >= 0)
+	{
+		scheduler = this;
+		index = worker_index;
+	}
+	return scheduler == this ? index : -1;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline void TaskScheduler<Priority, Heap>::work(const int worker_index)
+{
+	this->current_worker(worker_index);
+	while (true)
+	{
+		ScheduledTask<Priority>* task = this->pop(worker_index);
+		if (!task && this->steal(worker_index))
+		{
+			task = this->pop(worker_index);
+		}
+		if (task)
+		{
+			task->function()();
+			delete task;
+			if (this->pending_count_.fetch_sub(1) == 1)
+			{
+				std::lock_guard<std::mutex> lock(*this->idle_mutex_);
+				this->idle_condition_->notify_all();
+			}
+			continue;
+		}
+		if (this->stop_.load())
+		{
+			return;
+		}
+		std::unique_lock<std::mutex> lock(*this->idle_mutex_);
+		this->idle_condition_->wait_for(lock, std::chrono::milliseconds(1));
+	}
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline ScheduledTask<Priority>* TaskScheduler<Priority, Heap>::pop(const int worker_index)
+{
+	TaskSchedulerWorker<Priority, Heap>* worker = (*this->workers_)[worker_index];
+	if (worker->size() == 0)
+	{
+		return nullptr;
+	}
+	int identifier;
+	ScheduledTask<Priority>* task;
+	{
+		std::lock_guard<std::mutex> worker_lock(worker->mutex());
+		if (worker->heap()->size() == 0)
+		{
+			return nullptr;
+		}
+		task = worker->heap()->pop(identifier);
+		task->worker().store(-1);
+		worker->publish_size();
+	}
+	std::lock_guard<std::mutex> tasks_lock(*this->tasks_mutex_);
+	this->tasks_->erase(identifier);
+	return task;
+}
+
+template<typename Priority, template <typename, typename> class Heap>
+inline bool TaskScheduler<Priority, Heap>::steal(const int thief_index)
+{
+	static thread_local std::mt19937 generator(std::random_device{}());
+	int worker_count = (int)this->workers_->size();
+	int first_victim = generator() % worker_count;
+	for (int i = 0; i < worker_count; i++)
+	{
+		int victim_index = (first_victim + i) % worker_count;
+		TaskSchedulerWorker<Priority, Heap>* victim = (*this->workers_)[victim_index], * thief = (*this->workers_)[thief_index];
+		if (victim_index == thief_index || victim->size() == 0)
+		{
+			continue;
+		}
+		std::scoped_lock lock(victim->mutex(), thief->mutex());
+		size_t steal_size = (victim->heap()->size() + 1) / 2;
+		if (steal_size == 0)
+		{
+			continue;
+		}
+		Heap<Priority, ScheduledTask<Priority>*>* stolen_heap = new Heap<Priority, ScheduledTask<Priority>*>();
+		int identifier;
+		for (size_t j = 0; j < steal_size; j++)
+		{
+			Priority priority = victim->heap()->find_min()->node()->priority();
+			ScheduledTask<Priority>* task = victim->heap()->pop(identifier);
+			stolen_heap->push(identifier, priority, task, task->node());
+			task->worker().store(thief_index);
+		}
+		thief->heap()->merge(stolen_heap);
+		victim->publish_size();
+		thief->publish_size();
+		this->steal_count_.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+	return false;
+}
@@ -1,29 +1,38 @@
 #include "Test.h"
 
-void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit1Scenario& scenario)
+void Tests::execute_operations(PriorityQueueList<int, int>& pq_list, TestSuit1Scenario& scenario)
 {
-	for (int j = 0; j < 10; j++)
+	for (int i = 0; i < scenario.count(); i++)
 	{
-		for (int i = 0; i < scenario.count(); i++)
+		int number = rand() % scenario.p_erase();
+		if (number < scenario.p_push())
 		{
-			int number = rand() % scenario.p_change();
-			if (number < scenario.p_push())
-			{
-				pq_list.push(i, rand(), rand());
-			}
-			else if (number < scenario.p_pop() && pq_list.size() > 0)
-			{
-				pq_list.pop();
-			}
-			else if (pq_list.size() > 0)
-			{
-				pq_list.change_priority(pq_list.get_random_identifier(), rand());
-			}
-			else
-			{
-				i--;
-			}
+			pq_list.push(i, rand(), rand());
+		}
+		else if (number < scenario.p_pop() && pq_list.size() > 0)
+		{
+			pq_list.pop();
+		}
+		else if (number < scenario.p_change() && pq_list.size() > 0)
+		{
+			pq_list.change_priority(pq_list.get_random_identifier(), rand());
 		}
+		else if (pq_list.size() > 0)
+		{
+			pq_list.erase(pq_list.get_random_identifier());
+		}
+		else
+		{
+			i--;
+		}
+	}
+}
+
+void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit1Scenario& scenario)
+{
+	for (int j = 0; j < 10; j++)
+	{
+		execute_operations(pq_list, scenario);
 		pq_list.clear_structures();
 	}
 	system("pause");
@@ -38,7 +47,7 @@ void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit1Scenario&& sc
 void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit2Scenario& scenario)
 {
 	int push, pop, change, counter = 0, random;
-	for (double item_count = 10000; item_count < 2000000; item_count *= 1.5)
+	for (double item_count = scenario.item_count_from(); item_count < scenario.item_count_to(); item_count *= 1.5)
 	{
 		while (pq_list.size() < item_count)
 		{
@@ -86,3 +95,877 @@ void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit2Scenario&& sc
 	execute(pq_list, ts);
 }
 
+void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit4Scenario& scenario)
+{
+	int counter = 0;
+	std::vector<PriorityQueueOperation<int, int>> operations;
+	for (int tick = 0; tick < scenario.tick_count(); tick++)
+	{
+		operations.clear();
+		for (int i = 0; i < scenario.batch_size(); i++)
+		{
+			if (rand() % 100 < scenario.p_push() || pq_list.size() == 0)
+			{
+				operations.push_back(PriorityQueueOperation<int, int>(OperationType::PUSH, counter++, rand(), rand()));
+			}
+			else
+			{
+				operations.push_back(PriorityQueueOperation<int, int>(OperationType::CHANGE_PRIORITY, pq_list.get_random_identifier(), rand()));
+			}
+		}
+		if (scenario.batched())
+		{
+			pq_list.apply_batch(operations);
+		}
+		else
+		{
+			for (PriorityQueueOperation<int, int>& operation : operations)
+			{
+				if (operation.type() == OperationType::PUSH)
+				{
+					pq_list.push(operation.identifier(), operation.priority(), operation.data());
+				}
+			}
+			for (PriorityQueueOperation<int, int>& operation : operations)
+			{
+				if (operation.type() == OperationType::CHANGE_PRIORITY)
+				{
+					pq_list.change_priority(operation.identifier(), operation.priority());
+				}
+			}
+		}
+		for (int i = 0; i < scenario.pop_count() && pq_list.size() > 0; i++)
+		{
+			pq_list.pop();
+		}
+	}
+	pq_list.clear_structures();
+	system("pause");
+}
+
+void Tests::execute(PriorityQueueList<int, int>& pq_list, TestSuit4Scenario&& scenario)
+{
+	TestSuit4Scenario ts = scenario;
+	execute(pq_list, ts);
+}
+
+void Tests::coalescing(TestSuit1Scenario& scenario)
+{
+	const int max_burst_length = 4;
+	unsigned int seed = (unsigned int)time(NULL);
+	for (bool coalescing : { false, true })
+	{
+		srand(seed);
+		PriorityQueueList<int, int> pq_list({ new BinaryHeap<int, int>(), new PairingHeapTwoPass<int, int>(), new FibonacciHeap<int, int>() }, coalescing);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int i = 0; i < scenario.count(); i++)
+		{
+			int number = rand() % scenario.p_change();
+			if (number < scenario.p_push() || pq_list.size() == 0)
+			{
+				pq_list.push(i, rand(), rand());
+			}
+			else if (number < scenario.p_pop())
+			{
+				pq_list.pop();
+			}
+			else
+			{
+				int identifier = pq_list.get_random_identifier();
+				for (int burst_length = 1 + rand() % max_burst_length; burst_length > 0; burst_length--)
+				{
+					pq_list.change_priority(identifier, rand());
+				}
+			}
+		}
+		long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Zlucovanie zmien: " << (coalescing ? "zapnute" : "vypnute") << ", cas: " << duration << " ms, zmeny priority: " << pq_list.change_count()
+			<< ", usetrene preusporiadania: " << pq_list.saved_restructuring_count() << std::endl;
+	}
+	system("pause");
+}
+
+void Tests::coalescing(TestSuit1Scenario&& scenario)
+{
+	TestSuit1Scenario ts = scenario;
+	coalescing(ts);
+}
+
+template <typename Heap, typename Node>
+long long Tests::measure_nodes(Heap& heap, TestSuit1Scenario& scenario)
+{
+	std::vector<Node> nodes(scenario.count());
+	RandomizedSet identifiers;
+	int identifier;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < scenario.count(); i++)
+	{
+		int number = rand() % scenario.p_erase();
+		if (number < scenario.p_push())
+		{
+			heap.push(i, rand(), rand(), nodes[i]);
+			identifiers.insert(i);
+		}
+		else if (number < scenario.p_pop() && identifiers.size() > 0)
+		{
+			heap.pop(identifier);
+			identifiers.remove(identifier);
+		}
+		else if (number < scenario.p_change() && identifiers.size() > 0)
+		{
+			heap.change_priority(nodes[identifiers.get_random()], rand());
+		}
+		else if (identifiers.size() > 0)
+		{
+			identifier = identifiers.get_random();
+			heap.erase(nodes[identifier]);
+			identifiers.remove(identifier);
+		}
+		else
+		{
+			i--;
+		}
+	}
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+long long Tests::count_allocations(PriorityQueueWrapper<int, int>& wrapper, RandomizedSet& identifiers, TestSuit1Scenario& scenario)
+{
+	long long count = 0;
+	for (int i = 0; i < scenario.count(); i++)
+	{
+		int number = rand() % scenario.p_erase();
+		if (number < scenario.p_push())
+		{
+			int priority = rand();
+			int data = rand();
+			AllocationCounter::start();
+			wrapper.push(i, priority, data);
+			count += AllocationCounter::stop();
+			identifiers.insert(i);
+		}
+		else if (number < scenario.p_pop() && identifiers.size() > 0)
+		{
+			AllocationCounter::start();
+			int identifier = wrapper.pop();
+			count += AllocationCounter::stop();
+			identifiers.remove(identifier);
+		}
+		else if (number < scenario.p_change() && identifiers.size() > 0)
+		{
+			int identifier = identifiers.get_random();
+			int priority = rand();
+			AllocationCounter::start();
+			wrapper.change_priority(identifier, priority);
+			count += AllocationCounter::stop();
+		}
+		else if (identifiers.size() > 0)
+		{
+			int identifier = identifiers.get_random();
+			AllocationCounter::start();
+			wrapper.erase(identifier);
+			count += AllocationCounter::stop();
+			identifiers.remove(identifier);
+		}
+		else
+		{
+			i--;
+		}
+	}
+	return count;
+}
+
+void Tests::allocations(TestSuit1Scenario& scenario)
+{
+	const char* heap_names[] = { "BinaryHeap", "PairingHeapTwoPass", "PairingHeapMultiPass", "RankPairingHeap", "FibonacciHeap", "BinomialHeapOnePass", "BinomialHeapMultiPass" };
+	PriorityQueue<int, int>* (*heap_factories[])() = {
+		[]() -> PriorityQueue<int, int>* { return new BinaryHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new PairingHeapTwoPass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new PairingHeapMultiPass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new RankPairingHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new FibonacciHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new BinomialHeapOnePass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new BinomialHeapMultiPass<int, int>(); }
+	};
+	unsigned int seed = (unsigned int)time(NULL);
+	bool allocation_free = true;
+	for (size_t i = 0; i < sizeof(heap_factories) / sizeof(heap_factories[0]); i++)
+	{
+		PriorityQueue<int, int>* heap = heap_factories[i]();
+		heap->set_item_pooling(true);
+		PriorityQueueWrapper<int, int> wrapper(heap);
+		RandomizedSet identifiers;
+		srand(seed);
+		count_allocations(wrapper, identifiers, scenario);
+		while (identifiers.size() > 0)
+		{
+			identifiers.remove(wrapper.pop());
+		}
+		srand(seed);
+		long long steady_count = count_allocations(wrapper, identifiers, scenario);
+		allocation_free = allocation_free && steady_count == 0;
+		std::cout << "Alokacie po zahriati: " << heap_names[i] << ", " << steady_count << std::endl;
+	}
+	if (!allocation_free)
+	{
+		throw new std::logic_error("Tests::allocations(): Operacie po zahriati alokovali pamat");
+	}
+	system("pause");
+}
+
+void Tests::allocations(TestSuit1Scenario&& scenario)
+{
+	TestSuit1Scenario ts = scenario;
+	allocations(ts);
+}
+
+void Tests::compact_nodes(TestSuit1Scenario& scenario)
+{
+	unsigned int seed = (unsigned int)time(NULL);
+	long long duration;
+	{
+		srand(seed);
+		PairingHeapTwoPass<int, int> heap;
+		duration = measure_nodes<PairingHeapTwoPass<int, int>, PriorityQueueItem<int, int>*>(heap, scenario);
+		std::cout << "Parovacia halda: smernikove uzly, cas: " << duration << " ms, velkost uzla: " << sizeof(BinaryTreeItem<int, int>) << " B" << std::endl;
+	}
+	{
+		srand(seed);
+		CompactPairingHeap<int, int> heap;
+		duration = measure_nodes<CompactPairingHeap<int, int>, uint32_t>(heap, scenario);
+		std::cout << "Parovacia halda: kompaktne uzly, cas: " << duration << " ms, velkost uzla: " << sizeof(CompactPairingNode<int, int>) << " B" << std::endl;
+	}
+	{
+		srand(seed);
+		FibonacciHeap<int, int> heap;
+		duration = measure_nodes<FibonacciHeap<int, int>, PriorityQueueItem<int, int>*>(heap, scenario);
+		std::cout << "Fibonacciho halda: smernikove uzly, cas: " << duration << " ms, velkost uzla: " << sizeof(FibonacciHeapItem<int, int>) << " B" << std::endl;
+	}
+	{
+		srand(seed);
+		CompactFibonacciHeap<int, int> heap;
+		duration = measure_nodes<CompactFibonacciHeap<int, int>, uint32_t>(heap, scenario);
+		std::cout << "Fibonacciho halda: kompaktne uzly, cas: " << duration << " ms, velkost uzla: " << sizeof(CompactFibonacciNode<int, int>) << " B" << std::endl;
+	}
+	system("pause");
+}
+
+void Tests::compact_nodes(TestSuit1Scenario&& scenario)
+{
+	TestSuit1Scenario ts = scenario;
+	compact_nodes(ts);
+}
+
+void Tests::execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit5Scenario& scenario)
+{
+	long long sequential_duration = 0, reduction_duration = 0;
+	int identifier;
+	PriorityQueueItem<int, int>* node;
+	for (int round = 0; round < scenario.round_count(); round++)
+	{
+		for (bool reduction : { false, true })
+		{
+			std::vector<PriorityQueue<int, int>*> heaps;
+			int counter = 0;
+			for (int i = 0; i < scenario.heap_count(); i++)
+			{
+				heaps.push_back(create_heap());
+				for (int j = 0; j < scenario.heap_size(); j++)
+				{
+					heaps.back()->push(counter++, rand(), rand(), node);
+				}
+			}
+			PriorityQueue<int, int>* heap = create_heap();
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			if (reduction)
+			{
+				heap->merge_all(heaps);
+			}
+			else
+			{
+				for (PriorityQueue<int, int>* other_heap : heaps)
+				{
+					heap->merge(other_heap);
+				}
+			}
+			heap->pop(identifier);
+			long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+			(reduction ? reduction_duration : sequential_duration) += duration;
+			delete heap;
+		}
+	}
+	std::cout << "Fronty: " << scenario.heap_count() << ", prvky: " << (long long)scenario.heap_count() * scenario.heap_size()
+		<< ", po jednom: " << sequential_duration << " ms, merge_all: " << reduction_duration << " ms" << std::endl;
+	system("pause");
+}
+
+void Tests::execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit5Scenario&& scenario)
+{
+	TestSuit5Scenario ts = scenario;
+	execute(create_heap, ts);
+}
+
+void Tests::execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit9Scenario& scenario)
+{
+	PriorityQueue<int, int>* bulk_heap = create_heap();
+	PriorityQueue<int, int>* single_heap = create_heap();
+	std::vector<std::pair<int, int>> bulk_out, single_out;
+	bulk_out.reserve(scenario.pop_count());
+	single_out.reserve(scenario.pop_count());
+	long long bulk_duration = 0, single_duration = 0;
+	int identifier, counter = 0;
+	PriorityQueueItem<int, int>* node;
+	for (int step = 0; step < scenario.step_count(); step++)
+	{
+		for (int i = step == 0 ? -scenario.item_count() : 0; i < scenario.pop_count(); i++)
+		{
+			int priority = rand(), data = rand();
+			bulk_heap->push(counter, priority, data, node);
+			single_heap->push(counter, priority, data, node);
+			counter++;
+		}
+		bulk_out.clear();
+		single_out.clear();
+		for (bool bulk : { step % 2 == 0, step % 2 != 0 })
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			if (bulk)
+			{
+				bulk_heap->pop_n(scenario.pop_count(), bulk_out);
+			}
+			else
+			{
+				for (int i = 0; i < scenario.pop_count(); i++)
+				{
+					int data = single_heap->pop(identifier);
+					single_out.emplace_back(identifier, data);
+				}
+			}
+			(bulk ? bulk_duration : single_duration) += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		}
+		if (bulk_out != single_out)
+		{
+			throw new std::logic_error("Tests::execute(TestSuit9Scenario&): pop_n vybral ine prvky ako postupne volania pop");
+		}
+	}
+	delete bulk_heap;
+	delete single_heap;
+	std::cout << "Prvky: " << scenario.item_count() << ", kroky: " << scenario.step_count() << ", vyberane v kroku: " << scenario.pop_count()
+		<< ", pop_n: " << bulk_duration / 1000 << " ms, pop: " << single_duration / 1000 << " ms" << std::endl;
+	system("pause");
+}
+
+void Tests::execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit9Scenario&& scenario)
+{
+	TestSuit9Scenario ts = scenario;
+	execute(create_heap, ts);
+}
+
+void Tests::execute(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario& scenario)
+{
+	for (int thread_count = 1; thread_count <= scenario.thread_count(); thread_count *= 2)
+	{
+		for (int i = 0; i < scenario.item_count(); i++)
+		{
+			queue.push(i, rand(), rand());
+		}
+		std::vector<std::vector<long long>> push_latencies(thread_count), pop_latencies(thread_count);
+		std::vector<std::thread> threads;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int t = 0; t < thread_count; t++)
+		{
+			threads.emplace_back([&queue, &scenario, &push_latencies, &pop_latencies, t]()
+			{
+				std::mt19937 generator(t);
+				int identifier, data, counter = scenario.item_count() + t * scenario.operation_count();
+				push_latencies[t].reserve(scenario.operation_count() / scenario.sample_interval() + 1);
+				pop_latencies[t].reserve(scenario.operation_count() / scenario.sample_interval() + 1);
+				for (int i = 0; i < scenario.operation_count(); i++)
+				{
+					bool push = (int)(generator() % 100) < scenario.p_push(), sampled = i % scenario.sample_interval() == 0;
+					std::chrono::steady_clock::time_point operation_start;
+					if (sampled)
+					{
+						operation_start = std::chrono::steady_clock::now();
+					}
+					if (push)
+					{
+						queue.push(counter++, generator() % RAND_MAX, i);
+					}
+					else
+					{
+						queue.try_pop(identifier, data);
+					}
+					if (sampled)
+					{
+						long long latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - operation_start).count();
+						(push ? push_latencies[t] : pop_latencies[t]).push_back(latency);
+					}
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		long long duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		std::vector<long long> push_all, pop_all;
+		for (int t = 0; t < thread_count; t++)
+		{
+			push_all.insert(push_all.end(), push_latencies[t].begin(), push_latencies[t].end());
+			pop_all.insert(pop_all.end(), pop_latencies[t].begin(), pop_latencies[t].end());
+		}
+		long long operation_count = (long long)thread_count * scenario.operation_count();
+		std::cout << "Vlakna: " << thread_count << ", operacie: " << operation_count << ", vkladanie: " << scenario.p_push() << " %, cas: " << duration / 1000
+			<< " ms, priepustnost: " << (duration > 0 ? operation_count * 1000 / duration : 0) << " op/ms" << std::endl;
+		print_percentiles("  vkladanie", push_all);
+		print_percentiles("  vyberanie", pop_all);
+		queue.clear();
+	}
+	system("pause");
+}
+
+void Tests::execute(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario&& scenario)
+{
+	TestSuit3Scenario ts = scenario;
+	execute(queue, ts);
+}
+
+void Tests::rank_error(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario& scenario)
+{
+	const int priority_range = 32768;
+	std::vector<int> counts(priority_range + 1, 0);
+	long long rank_sum = 0, pop_count = 0, operation_count = (long long)scenario.thread_count() * scenario.operation_count();
+	int rank_max = 0, counter = 0, identifier, priority;
+	for (long long i = 0; i < scenario.item_count() + operation_count; i++)
+	{
+		if (i < scenario.item_count() || rand() % 100 < scenario.p_push())
+		{
+			priority = rand() % priority_range;
+			queue.push(counter++, priority, priority);
+			for (int j = priority + 1; j <= priority_range; j += j & -j)
+			{
+				counts[j]++;
+			}
+		}
+		else if (queue.try_pop(identifier, priority))
+		{
+			int rank = 0;
+			for (int j = priority; j > 0; j -= j & -j)
+			{
+				rank += counts[j];
+			}
+			for (int j = priority + 1; j <= priority_range; j += j & -j)
+			{
+				counts[j]--;
+			}
+			rank_sum += rank;
+			rank_max = std::max(rank_max, rank);
+			pop_count++;
+		}
+	}
+	std::cout << "Chyba poradia: priemer " << (pop_count > 0 ? (double)rank_sum / pop_count : 0.0) << ", maximum " << rank_max << std::endl;
+	queue.clear();
+	system("pause");
+}
+
+void Tests::rank_error(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario&& scenario)
+{
+	TestSuit3Scenario ts = scenario;
+	rank_error(queue, ts);
+}
+
+void Tests::print_percentiles(const char* name, std::vector<long long>& latencies)
+{
+	if (latencies.empty())
+	{
+		return;
+	}
+	std::sort(latencies.begin(), latencies.end());
+	std::cout << name << " latencia [ns]:";
+	for (double percentile : { 50.0, 90.0, 99.0, 99.9 })
+	{
+		size_t index = std::min(latencies.size() - 1, (size_t)(percentile / 100.0 * latencies.size()));
+		std::cout << " p" << percentile << " " << latencies[index] << ",";
+	}
+	std::cout << " max " << latencies.back() << std::endl;
+}
+
+void Tests::published_minimum(TestSuit3Scenario& scenario)
+{
+	for (bool published : { false, true })
+	{
+		for (int reader_count = 0; reader_count <= scenario.thread_count(); reader_count = reader_count ? reader_count * 2 : 1)
+		{
+			PublishingPriorityQueue<int, int> queue(new PairingHeapTwoPass<int, int>());
+			std::mutex mutex;
+			std::atomic<bool> done(false);
+			std::atomic<long long> read_count(0);
+			PriorityQueueItem<int, int>* node;
+			for (int i = 0; i < scenario.item_count(); i++)
+			{
+				queue.push(i, rand(), rand(), node);
+			}
+			std::vector<std::thread> readers;
+			for (int t = 0; t < reader_count; t++)
+			{
+				readers.emplace_back([&queue, &mutex, &done, &read_count, published]()
+				{
+					int identifier, priority;
+					long long reads = 0;
+					while (!done.load(std::memory_order_relaxed))
+					{
+						if (published)
+						{
+							queue.read_min(identifier, priority);
+						}
+						else
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							if (queue.size() > 0)
+							{
+								identifier = queue.find_min_item()->identifier();
+							}
+						}
+						reads++;
+					}
+					read_count.fetch_add(reads);
+				});
+			}
+			int identifier, counter = scenario.item_count();
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for (int i = 0; i < scenario.operation_count(); i++)
+			{
+				std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+				if (!published)
+				{
+					lock.lock();
+				}
+				if (rand() % 100 < scenario.p_push() || queue.size() == 0)
+				{
+					queue.push(counter++, rand(), i, node);
+				}
+				else
+				{
+					queue.pop(identifier);
+				}
+			}
+			long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+			done.store(true);
+			for (std::thread& reader : readers)
+			{
+				reader.join();
+			}
+			std::cout << (published ? "Zverejnene minimum" : "Zamok") << ", citatelia: " << reader_count << ", operacie: " << scenario.operation_count()
+				<< ", cas: " << duration << " ms, citania: " << read_count.load() << std::endl;
+		}
+	}
+	system("pause");
+}
+
+void Tests::published_minimum(TestSuit3Scenario&& scenario)
+{
+	TestSuit3Scenario ts = scenario;
+	published_minimum(ts);
+}
+
+void Tests::ingestion(TestSuit3Scenario& scenario)
+{
+	for (int producer_count = 1; producer_count <= scenario.thread_count(); producer_count *= 2)
+	{
+		long long durations[2];
+		for (int mode = 0; mode < 2; mode++)
+		{
+			ConcurrentPriorityQueue<int, int>* queue;
+			if (mode == 0)
+			{
+				queue = new LockedPriorityQueue<int, int>(new BinaryHeap<int, int>());
+			}
+			else
+			{
+				queue = new IngestingPriorityQueue<int, int, BinaryHeap>(4096, producer_count == 1);
+			}
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			std::vector<std::thread> producers;
+			for (int t = 0; t < producer_count; t++)
+			{
+				producers.emplace_back([queue, &scenario, t]()
+				{
+					std::mt19937 generator(t);
+					for (int i = 0; i < scenario.operation_count(); i++)
+					{
+						queue->push(t * scenario.operation_count() + i, generator() % RAND_MAX, i);
+					}
+				});
+			}
+			int identifier, data;
+			long long remaining = (long long)producer_count * scenario.operation_count();
+			while (remaining > 0)
+			{
+				if (queue->try_pop(identifier, data))
+				{
+					remaining--;
+				}
+			}
+			for (std::thread& producer : producers)
+			{
+				producer.join();
+			}
+			durations[mode] = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+			delete queue;
+		}
+		std::cout << "Producenti: " << producer_count << ", prvky: " << (long long)producer_count * scenario.operation_count()
+			<< ", zamok: " << durations[0] << " ms, kruhovy zasobnik: " << durations[1] << " ms" << std::endl;
+	}
+	system("pause");
+}
+
+void Tests::ingestion(TestSuit3Scenario&& scenario)
+{
+	TestSuit3Scenario ts = scenario;
+	ingestion(ts);
+}
+
+template <template <typename, typename> class Heap>
+void Tests::schedule(TestSuit6Scenario& scenario, const int worker_count)
+{
+	const int priority_range = 32768;
+	std::atomic<long long> sequence(0);
+	std::vector<long long> start_sequences(scenario.task_count());
+	std::vector<std::vector<long long>> events;
+	long long steal_count;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	{
+		TaskScheduler<int, Heap> scheduler(worker_count);
+		for (int i = 0; i < scenario.task_count(); i++)
+		{
+			int priority = rand() % priority_range;
+			events.push_back({ sequence.fetch_add(1), i, priority });
+			int identifier = scheduler.submit(priority, [&sequence, &start_sequences, &scenario, i]()
+			{
+				start_sequences[i] = sequence.fetch_add(1);
+				volatile int work = 0;
+				for (int j = 0; j < scenario.task_work(); j++)
+				{
+					work = work + j;
+				}
+			});
+			if (rand() % 100 < scenario.p_reprioritize())
+			{
+				int reprioritized = rand() % (identifier + 1);
+				priority = rand() % priority_range;
+				if (scheduler.reprioritize(reprioritized, priority))
+				{
+					events.push_back({ sequence.fetch_add(1), reprioritized, priority });
+				}
+			}
+		}
+		scheduler.wait_idle();
+		steal_count = scheduler.steal_count();
+	}
+	long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	for (int i = 0; i < scenario.task_count(); i++)
+	{
+		events.push_back({ start_sequences[i], i, -1 });
+	}
+	std::sort(events.begin(), events.end());
+	std::vector<int> counts(priority_range + 1, 0), priorities(scenario.task_count(), -1);
+	long long inversion_sum = 0;
+	int inversion_max = 0;
+	for (std::vector<long long>& event : events)
+	{
+		int identifier = (int)event[1], priority = (int)event[2];
+		if (priorities[identifier] >= 0)
+		{
+			for (int j = priorities[identifier] + 1; j <= priority_range; j += j & -j)
+			{
+				counts[j]--;
+			}
+		}
+		if (priority >= 0 && priorities[identifier] != -2)
+		{
+			priorities[identifier] = priority;
+			for (int j = priority + 1; j <= priority_range; j += j & -j)
+			{
+				counts[j]++;
+			}
+		}
+		else if (priority < 0)
+		{
+			int inversion = 0;
+			for (int j = priorities[identifier]; j > 0; j -= j & -j)
+			{
+				inversion += counts[j];
+			}
+			inversion_sum += inversion;
+			inversion_max = std::max(inversion_max, inversion);
+			priorities[identifier] = -2;
+		}
+	}
+	std::cout << "Pracovnici: " << worker_count << ", ulohy: " << scenario.task_count() << ", cas: " << duration << " ms, kradeze: " << steal_count
+		<< ", inverzia priority: priemer " << (double)inversion_sum / scenario.task_count() << ", maximum " << inversion_max << std::endl;
+}
+
+void Tests::execute(TestSuit6Scenario& scenario)
+{
+	for (int worker_count = 1; worker_count <= scenario.worker_count(); worker_count *= 2)
+	{
+		schedule<PairingHeapTwoPass>(scenario, worker_count);
+		schedule<BinaryHeap>(scenario, worker_count);
+	}
+	system("pause");
+}
+
+void Tests::execute(TestSuit6Scenario&& scenario)
+{
+	TestSuit6Scenario ts = scenario;
+	execute(ts);
+}
+
+template <template <typename, typename> class Heap>
+TimerCoroutine Tests::sleep_repeatedly(TimerService<Heap>& service, const long long horizon, long long& resume_count)
+{
+	while (service.now() < horizon)
+	{
+		co_await service.sleep_until(service.now() + 1 + rand() % 100);
+		resume_count++;
+	}
+}
+
+template <template <typename, typename> class Heap>
+void Tests::timers(TestSuit7Scenario& scenario, const char* heap_name)
+{
+	long long fired_count = 0, cancel_count = 0, reschedule_count = 0, resume_count = 0;
+	std::vector<long long> handles(scenario.timer_count());
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	{
+		TimerService<Heap> service;
+		std::function<void(int)> arm = [&service, &handles, &scenario, &fired_count, &arm](int i)
+		{
+			handles[i] = service.schedule(service.now() + 1 + rand() % scenario.tick_count(), [&fired_count, &arm, i]()
+			{
+				fired_count++;
+				arm(i);
+			});
+		};
+		for (int i = 0; i < scenario.timer_count(); i++)
+		{
+			arm(i);
+		}
+		for (int i = 0; i < scenario.coroutine_count(); i++)
+		{
+			sleep_repeatedly(service, scenario.tick_count(), resume_count);
+		}
+		for (long long tick = 1; tick <= scenario.tick_count(); tick++)
+		{
+			for (int j = 0; j < scenario.timer_count() / scenario.tick_count(); j++)
+			{
+				int i = rand() % scenario.timer_count(), operation = rand() % 100;
+				if (operation < scenario.p_cancel())
+				{
+					service.cancel(handles[i]);
+					arm(i);
+					cancel_count++;
+				}
+				else if (operation < scenario.p_cancel() + scenario.p_reschedule())
+				{
+					service.reschedule(handles[i], tick + 1 + rand() % scenario.tick_count());
+					reschedule_count++;
+				}
+			}
+			service.advance(tick);
+		}
+		service.advance(scenario.tick_count() + 100);
+	}
+	long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << heap_name << " casovace: " << scenario.timer_count() << ", tiky: " << scenario.tick_count() << ", uplynute: " << fired_count
+		<< ", zrusene: " << cancel_count << ", presunute: " << reschedule_count << ", prebudenia korutin: " << resume_count << ", cas: " << duration << " ms" << std::endl;
+}
+
+void Tests::execute(TestSuit7Scenario& scenario)
+{
+	timers<PairingHeapTwoPass>(scenario, "PairingHeapTwoPass");
+	timers<FibonacciHeap>(scenario, "FibonacciHeap");
+	timers<BinaryHeap>(scenario, "BinaryHeap");
+	system("pause");
+}
+
+void Tests::execute(TestSuit7Scenario&& scenario)
+{
+	TestSuit7Scenario ts = scenario;
+	execute(ts);
+}
+
+void Tests::execute(TestSuit8Scenario& scenario)
+{
+	MinMaxHeap<int, int> heap(scenario.capacity());
+	std::set<std::pair<int, int>> reference;
+	std::vector<PriorityQueueItem<int, int>*> nodes(scenario.count());
+	std::vector<int> priorities(scenario.count());
+	RandomizedSet identifiers;
+	int identifier, evicted_identifier, data, evicted_data;
+	long long evict_count = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < scenario.count(); i++)
+	{
+		int number = rand() % scenario.p_change();
+		if (number < scenario.p_push() || identifiers.size() == 0)
+		{
+			priorities[i] = rand();
+			reference.insert(std::make_pair(priorities[i], i));
+			identifiers.insert(i);
+			if (heap.push(i, priorities[i], i, nodes[i], evicted_identifier, evicted_data))
+			{
+				if (evicted_identifier != reference.rbegin()->second || evicted_data != evicted_identifier)
+				{
+					throw new std::logic_error("Tests::execute(TestSuit8Scenario&): Vyradeny bol iny prvok ako prvok s najmensou prioritou");
+				}
+				reference.erase(std::prev(reference.end()));
+				identifiers.remove(evicted_identifier);
+				evict_count++;
+			}
+		}
+		else if (number < scenario.p_pop())
+		{
+			data = heap.pop(identifier);
+			if (identifier != reference.begin()->second || data != identifier)
+			{
+				throw new std::logic_error("Tests::execute(TestSuit8Scenario&): Vybrany bol iny prvok ako prvok s najvacsou prioritou");
+			}
+			reference.erase(reference.begin());
+			identifiers.remove(identifier);
+		}
+		else if (number < scenario.p_pop_max())
+		{
+			if (heap.find_max() != reference.rbegin()->second)
+			{
+				throw new std::logic_error("Tests::execute(TestSuit8Scenario&): find_max nevratil prvok s najmensou prioritou");
+			}
+			data = heap.pop_max(identifier);
+			if (identifier != reference.rbegin()->second || data != identifier)
+			{
+				throw new std::logic_error("Tests::execute(TestSuit8Scenario&): pop_max vybral iny prvok ako prvok s najmensou prioritou");
+			}
+			reference.erase(std::prev(reference.end()));
+			identifiers.remove(identifier);
+		}
+		else
+		{
+			identifier = identifiers.get_random();
+			reference.erase(std::make_pair(priorities[identifier], identifier));
+			priorities[identifier] = rand();
+			reference.insert(std::make_pair(priorities[identifier], identifier));
+			heap.change_priority(nodes[identifier], priorities[identifier]);
+		}
+	}
+	long long duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "MinMaxHeap kapacita: " << scenario.capacity() << ", operacie: " << scenario.count() << ", vyradene: " << evict_count << ", cas: " << duration << " ms" << std::endl;
+	system("pause");
+}
+
+void Tests::execute(TestSuit8Scenario&& scenario)
+{
+	TestSuit8Scenario ts = scenario;
+	execute(ts);
+}
@@ -3,16 +3,81 @@
 #include <random>
 #include <iostream>
 #include <list>
+#include <set>
 #include <unordered_map>
 #include <chrono>
+#include <thread>
+#include <vector>
 #include "Wrapper.h"
+#include "SkipListPriorityQueue.h"
+#include "MultiQueue.h"
+#include "FlatCombiningPriorityQueue.h"
+#include "IngestingPriorityQueue.h"
+#include "PublishingPriorityQueue.h"
+#include "TaskScheduler.h"
+#include "TimerService.h"
+#include "CompactHeap.h"
+#include "SimdHeap.h"
+#include "BucketQueue.h"
 #include "TestScenarios.h"
+#include "AllocationCounter.h"
 
 /// <summary>
 /// Testy
 /// </summary>
 class Tests
 {
+private:
+	/// <summary>
+	/// Vykon scenr.count() nhodnch operci scenra sady 1
+	/// </summary>
+	/// <param name="pq_list">Zoznam prioritnch frontov</param>
+	/// <param name="scenario">Scenr</param>
+	static void execute_operations(PriorityQueueList<int, int>& pq_list, TestSuit1Scenario& scenario);
+	/// <summary>
+	/// Vykon scenr sady 6 plnovaom s worker_count pracovnkmi, ktorch fronty s typu Heap
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	/// <param name="worker_count">Poet pracovnkov</param>
+	template <template <typename, typename> class Heap>
+	static void schedule(TestSuit6Scenario& scenario, const int worker_count);
+	/// <summary>
+	/// Vykon scenr sady 7 slubou asovaov, ktorej termny s v prioritnom fronte typu Heap
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	/// <param name="heap_name">Nzov prioritnho frontu vo vpise</param>
+	template <template <typename, typename> class Heap>
+	static void timers(TestSuit7Scenario& scenario, const char* heap_name);
+	/// <summary>
+	/// Vykon opercie scenra sady 1 priamo nad prioritnm frontom heap, prvky sa odkazuj rukovami typu Node
+	/// </summary>
+	/// <param name="heap">Prioritn front</param>
+	/// <param name="scenario">Scenr</param>
+	/// <returns>as v milisekundch</returns>
+	template <typename Heap, typename Node>
+	static long long measure_nodes(Heap& heap, TestSuit1Scenario& scenario);
+	/// <summary>
+	/// Vykon opercie scenra sady 1 nad obalenm prioritnm frontom a spota alokcie poas volan obaujcej triedy
+	/// </summary>
+	/// <param name="wrapper">Obalen prioritn front</param>
+	/// <param name="identifiers">Identifiktory prvkov v prioritnom fronte</param>
+	/// <param name="scenario">Scenr</param>
+	/// <returns>Poet alokci</returns>
+	static long long count_allocations(PriorityQueueWrapper<int, int>& wrapper, RandomizedSet& identifiers, TestSuit1Scenario& scenario);
+	/// <summary>
+	/// Vype percentily latenci opercie
+	/// </summary>
+	/// <param name="name">Nzov opercie</param>
+	/// <param name="latencies">Nameran latencie v nanosekundch, funkcia ich usporiada</param>
+	static void print_percentiles(const char* name, std::vector<long long>& latencies);
+	/// <summary>
+	/// Korutina, ktor opakovane sp nhodne dlho, km as sluby nedosiahne horizont
+	/// </summary>
+	/// <param name="service">Sluba asovaov</param>
+	/// <param name="horizon">as, po ktorom korutina skon</param>
+	/// <param name="resume_count">Poet prebuden korutn</param>
+	template <template <typename, typename> class Heap>
+	static TimerCoroutine sleep_repeatedly(TimerService<Heap>& service, const long long horizon, long long& resume_count);
 public:
 	/// <summary>
 	/// Test pre testov sadu 1
@@ -28,4 +93,93 @@ public:
 	/// <param name="scenario">Scenr</param>
 	static void execute(PriorityQueueList<int, int>& pq_list, TestSuit2Scenario& scenario);
 	static void execute(PriorityQueueList<int, int>& pq_list, TestSuit2Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 4, opercie prichdzaj v dvkach, ktor sa aplikuj naraz alebo po jednej
+	/// </summary>
+	/// <param name="pq_list">Zoznam prioritnch frontov</param>
+	/// <param name="scenario">Scenr</param>
+	static void execute(PriorityQueueList<int, int>& pq_list, TestSuit4Scenario& scenario);
+	static void execute(PriorityQueueList<int, int>& pq_list, TestSuit4Scenario&& scenario);
+	/// <summary>
+	/// Zmeria as scenra sady 1, v ktorom sa priorita prvku men vo vbuchoch niekokch zmien, raz bez zluovania a raz so zluovanm zmien priority
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void coalescing(TestSuit1Scenario& scenario);
+	static void coalescing(TestSuit1Scenario&& scenario);
+	/// <summary>
+	/// Over, e opercie obalenho prioritnho frontu po zahriat nealokuj, scenr sady 1 sa vykon raz na zahriatie,
+	/// front sa vyprzdni vberom a scenr sa vykon znova s rovnakmi nhodnmi slami, pri nenulovom pote alokci vyhod vnimku
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void allocations(TestSuit1Scenario& scenario);
+	static void allocations(TestSuit1Scenario&& scenario);
+	/// <summary>
+	/// Porovn as scenra sady 1 a vekos uzla provacej a Fibonacciho haldy so smernkovmi a s kompaktnmi uzlami
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void compact_nodes(TestSuit1Scenario& scenario);
+	static void compact_nodes(TestSuit1Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 5, porovn postupn pripjanie mnohch frontov po jednom s ich pripojenm naraz cez merge_all
+	/// </summary>
+	/// <param name="create_heap">Vytvor przdny prioritn front testovanho typu</param>
+	/// <param name="scenario">Scenr</param>
+	static void execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit5Scenario& scenario);
+	static void execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit5Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 9, v kadom kroku dopln front o pop_count prvkov a vyberie z neho pop_count najlepch prvkov,
+	/// raz jednm volanm pop_n a raz postupnmi volaniami pop nad druhm frontom s rovnakmi prvkami, pri rozdielnom vsledku vyhod vnimku
+	/// </summary>
+	/// <param name="create_heap">Vytvor przdny prioritn front testovanho typu</param>
+	/// <param name="scenario">Scenr</param>
+	static void execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit9Scenario& scenario);
+	static void execute(PriorityQueue<int, int>* (*create_heap)(), TestSuit9Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 3, pre kad poet vlkien zmeria priepustnos sbenho prioritnho frontu pri pomere vkladan p_push
+	/// a percentily latencie vkladania a vberu z kadej sample_interval-tej opercie
+	/// </summary>
+	/// <param name="queue">Sben prioritn front</param>
+	/// <param name="scenario">Scenr</param>
+	static void execute(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario& scenario);
+	static void execute(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario&& scenario);
+	/// <summary>
+	/// Zmeria chybu poradia vyberanch prvkov, teda poet prvkov s vou prioritou, ktor boli v ase vberu vo fronte
+	/// Opercie scenra sa vykonaj jednm vlknom, striktn prioritn fronty maj chybu 0
+	/// </summary>
+	/// <param name="queue">Sben prioritn front</param>
+	/// <param name="scenario">Scenr</param>
+	static void rank_error(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario& scenario);
+	static void rank_error(ConcurrentPriorityQueue<int, int>& queue, TestSuit3Scenario&& scenario);
+	/// <summary>
+	/// Zmeria as zapisujceho vlkna, km ostatn vlkna taj minimum, raz pod zmkom a raz cez zverejnen minimum
+	/// </summary>
+	/// <param name="scenario">Scenr, poet vlkien je najv poet itateov</param>
+	static void published_minimum(TestSuit3Scenario& scenario);
+	static void published_minimum(TestSuit3Scenario&& scenario);
+	/// <summary>
+	/// Zmeria as, km jeden konzument vyberie vetky prvky vkladan producentmi, raz cez front chrnen zmkom a raz cez kruhov zsobnk
+	/// </summary>
+	/// <param name="scenario">Scenr, poet vlkien je najv poet producentov, poet operci je poet prvkov jednho producenta</param>
+	static void ingestion(TestSuit3Scenario& scenario);
+	static void ingestion(TestSuit3Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 6, meria priepustnos plnovaa loh a inverziu priority,
+	/// teda poet akajcich loh s vou prioritou v ase spustenia lohy, zmena priority sa zaznamen a po jej vykonan, preto je inverzia priblin
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void execute(TestSuit6Scenario& scenario);
+	static void execute(TestSuit6Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 7, meria slubu asovaov s trvalo aktvnymi asovami, ktor sa ruia, presvaj a po uplynut znovu plnuj
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void execute(TestSuit7Scenario& scenario);
+	static void execute(TestSuit7Scenario&& scenario);
+	/// <summary>
+	/// Test pre testov sadu 8, vykon opercie nad obojstrannou haldou s obmedzenou kapacitou a porovn vybran a vyraden prvky
+	/// s usporiadanou mnoinou, pri nezhode vyhod vnimku
+	/// </summary>
+	/// <param name="scenario">Scenr</param>
+	static void execute(TestSuit8Scenario& scenario);
+	static void execute(TestSuit8Scenario&& scenario);
 };
@@ -5,8 +5,8 @@ Scenario::Scenario()
 }
 
 
-TestSuit1Scenario::TestSuit1Scenario(int p_push, int p_pop, int p_change, int count) :
-	p_push_(p_push), p_pop_(p_pop), p_change_(p_change), count_(count)
+TestSuit1Scenario::TestSuit1Scenario(int p_push, int p_pop, int p_change, int count, int p_erase) :
+	p_push_(p_push), p_pop_(p_pop), p_change_(p_change), count_(count), p_erase_(p_erase)
 {
 }
 
@@ -26,6 +26,11 @@ int TestSuit1Scenario::p_change()
 	return this->p_change_ + this->p_pop();
 }
 
+int TestSuit1Scenario::p_erase()
+{
+	return this->p_erase_ + this->p_change();
+}
+
 int TestSuit1Scenario::count()
 {
 	return this->count_;
@@ -56,8 +61,14 @@ TS1ScenarioE::TS1ScenarioE() :
 {
 }
 
-TestSuit2Scenario::TestSuit2Scenario(int operation_count, int iteration_count, double insert_ratio) :
-	Scenario(), operation_count_(operation_count), iteration_count_(iteration_count), insert_ratio_(insert_ratio)
+TS1ScenarioF::TS1ScenarioF() :
+	TestSuit1Scenario(50, 10, 5, 1000000, 35)
+{
+}
+
+TestSuit2Scenario::TestSuit2Scenario(int operation_count, int iteration_count, double insert_ratio, double item_count_from, double item_count_to) :
+	Scenario(), operation_count_(operation_count), iteration_count_(iteration_count), insert_ratio_(insert_ratio),
+	item_count_from_(item_count_from), item_count_to_(item_count_to)
 {
 }
 
@@ -76,6 +87,16 @@ double TestSuit2Scenario::insert_ratio()
 	return this->insert_ratio_;
 }
 
+double TestSuit2Scenario::item_count_from()
+{
+	return this->item_count_from_;
+}
+
+double TestSuit2Scenario::item_count_to()
+{
+	return this->item_count_to_;
+}
+
 TS2ScenarioA::TS2ScenarioA() :
 	TestSuit2Scenario(100, 1, 1.0)
 {
@@ -85,3 +106,278 @@ TS2ScenarioB::TS2ScenarioB() :
 	TestSuit2Scenario(100, 10000, 0.66)
 {
 }
+
+TS2ScenarioC::TS2ScenarioC() :
+	TestSuit2Scenario(100, 10000, 0.66, 2000000, 7000000)
+{
+}
+
+TS2ScenarioD::TS2ScenarioD() :
+	TestSuit2Scenario(100, 10000, 0.66, 1000000, 2000000)
+{
+}
+
+TestSuit3Scenario::TestSuit3Scenario(int thread_count, int operation_count, int p_push, int item_count, int sample_interval) :
+	Scenario(), thread_count_(thread_count), operation_count_(operation_count), p_push_(p_push), item_count_(item_count), sample_interval_(sample_interval)
+{
+}
+
+int TestSuit3Scenario::thread_count()
+{
+	return this->thread_count_;
+}
+
+int TestSuit3Scenario::operation_count()
+{
+	return this->operation_count_;
+}
+
+int TestSuit3Scenario::p_push()
+{
+	return this->p_push_;
+}
+
+int TestSuit3Scenario::item_count()
+{
+	return this->item_count_;
+}
+
+int TestSuit3Scenario::sample_interval()
+{
+	return this->sample_interval_;
+}
+
+TS3ScenarioA::TS3ScenarioA() :
+	TestSuit3Scenario(8, 1000000, 50, 100000)
+{
+}
+
+TS3ScenarioB::TS3ScenarioB() :
+	TestSuit3Scenario(8, 1000000, 80, 0)
+{
+}
+
+TS3ScenarioC::TS3ScenarioC() :
+	TestSuit3Scenario(8, 1000000, 10, 1000000)
+{
+}
+
+TestSuit4Scenario::TestSuit4Scenario(int tick_count, int batch_size, int p_push, int pop_count, bool batched) :
+	Scenario(), tick_count_(tick_count), batch_size_(batch_size), p_push_(p_push), pop_count_(pop_count), batched_(batched)
+{
+}
+
+int TestSuit4Scenario::tick_count()
+{
+	return this->tick_count_;
+}
+
+int TestSuit4Scenario::batch_size()
+{
+	return this->batch_size_;
+}
+
+int TestSuit4Scenario::p_push()
+{
+	return this->p_push_;
+}
+
+int TestSuit4Scenario::pop_count()
+{
+	return this->pop_count_;
+}
+
+bool TestSuit4Scenario::batched()
+{
+	return this->batched_;
+}
+
+TS4ScenarioA::TS4ScenarioA() :
+	TestSuit4Scenario(100, 50000, 50, 20000, true)
+{
+}
+
+TS4ScenarioB::TS4ScenarioB() :
+	TestSuit4Scenario(100, 50000, 50, 20000, false)
+{
+}
+
+TestSuit5Scenario::TestSuit5Scenario(int round_count, int heap_count, int heap_size) :
+	Scenario(), round_count_(round_count), heap_count_(heap_count), heap_size_(heap_size)
+{
+}
+
+int TestSuit5Scenario::round_count()
+{
+	return this->round_count_;
+}
+
+int TestSuit5Scenario::heap_count()
+{
+	return this->heap_count_;
+}
+
+int TestSuit5Scenario::heap_size()
+{
+	return this->heap_size_;
+}
+
+TS5ScenarioA::TS5ScenarioA() :
+	TestSuit5Scenario(5, 256, 1000)
+{
+}
+
+TS5ScenarioB::TS5ScenarioB() :
+	TestSuit5Scenario(5, 16, 50000)
+{
+}
+
+TestSuit6Scenario::TestSuit6Scenario(int worker_count, int task_count, int task_work, int p_reprioritize) :
+	Scenario(), worker_count_(worker_count), task_count_(task_count), task_work_(task_work), p_reprioritize_(p_reprioritize)
+{
+}
+
+int TestSuit6Scenario::worker_count()
+{
+	return this->worker_count_;
+}
+
+int TestSuit6Scenario::task_count()
+{
+	return this->task_count_;
+}
+
+int TestSuit6Scenario::task_work()
+{
+	return this->task_work_;
+}
+
+int TestSuit6Scenario::p_reprioritize()
+{
+	return this->p_reprioritize_;
+}
+
+TS6ScenarioA::TS6ScenarioA() :
+	TestSuit6Scenario(8, 200000, 100, 10)
+{
+}
+
+TS6ScenarioB::TS6ScenarioB() :
+	TestSuit6Scenario(8, 50000, 5000, 30)
+{
+}
+
+TestSuit7Scenario::TestSuit7Scenario(int timer_count, int tick_count, int p_cancel, int p_reschedule, int coroutine_count) :
+	Scenario(), timer_count_(timer_count), tick_count_(tick_count), p_cancel_(p_cancel), p_reschedule_(p_reschedule), coroutine_count_(coroutine_count)
+{
+}
+
+int TestSuit7Scenario::timer_count()
+{
+	return this->timer_count_;
+}
+
+int TestSuit7Scenario::tick_count()
+{
+	return this->tick_count_;
+}
+
+int TestSuit7Scenario::p_cancel()
+{
+	return this->p_cancel_;
+}
+
+int TestSuit7Scenario::p_reschedule()
+{
+	return this->p_reschedule_;
+}
+
+int TestSuit7Scenario::coroutine_count()
+{
+	return this->coroutine_count_;
+}
+
+TS7ScenarioA::TS7ScenarioA() :
+	TestSuit7Scenario(1000000, 1000, 10, 30, 10000)
+{
+}
+
+TS7ScenarioB::TS7ScenarioB() :
+	TestSuit7Scenario(1000000, 100, 40, 40, 0)
+{
+}
+
+TestSuit8Scenario::TestSuit8Scenario(int capacity, int count, int p_push, int p_pop, int p_pop_max, int p_change) :
+	Scenario(), capacity_(capacity), count_(count), p_push_(p_push), p_pop_(p_pop), p_pop_max_(p_pop_max), p_change_(p_change)
+{
+}
+
+int TestSuit8Scenario::capacity()
+{
+	return this->capacity_;
+}
+
+int TestSuit8Scenario::count()
+{
+	return this->count_;
+}
+
+int TestSuit8Scenario::p_push()
+{
+	return this->p_push_;
+}
+
+int TestSuit8Scenario::p_pop()
+{
+	return this->p_pop_ + this->p_push();
+}
+
+int TestSuit8Scenario::p_pop_max()
+{
+	return this->p_pop_max_ + this->p_pop();
+}
+
+int TestSuit8Scenario::p_change()
+{
+	return this->p_change_ + this->p_pop_max();
+}
+
+TS8ScenarioA::TS8ScenarioA() :
+	TestSuit8Scenario(1000, 1000000, 60, 15, 15, 10)
+{
+}
+
+TS8ScenarioB::TS8ScenarioB() :
+	TestSuit8Scenario(100000, 1000000, 50, 10, 20, 20)
+{
+}
+
+TestSuit9Scenario::TestSuit9Scenario(int item_count, int step_count, int pop_count) :
+	Scenario(), item_count_(item_count), step_count_(step_count), pop_count_(pop_count)
+{
+}
+
+int TestSuit9Scenario::item_count()
+{
+	return this->item_count_;
+}
+
+int TestSuit9Scenario::step_count()
+{
+	return this->step_count_;
+}
+
+int TestSuit9Scenario::pop_count()
+{
+	return this->pop_count_;
+}
+
+TS9ScenarioA::TS9ScenarioA() :
+	TestSuit9Scenario(1000000, 1000, 1000)
+{
+}
+
+TS9ScenarioB::TS9ScenarioB() :
+	TestSuit9Scenario(100000, 20000, 16)
+{
+}
@@ -13,21 +13,86 @@ public:
 class TestSuit1Scenario : public Scenario
 {
 private:
-	int p_push_, p_pop_, p_change_, count_;
+	int p_push_, p_pop_, p_change_, count_, p_erase_;
 public:
-	TestSuit1Scenario(int p_push, int p_pop, int p_change, int count);
-	int p_push(), p_pop(), p_change(), count();
+	TestSuit1Scenario(int p_push, int p_pop, int p_change, int count, int p_erase = 0);
+	int p_push(), p_pop(), p_change(), p_erase(), count();
 };
 
 class TestSuit2Scenario : public Scenario
 {
 private:
 	int operation_count_, iteration_count_;
-	double insert_ratio_;
+	double insert_ratio_, item_count_from_, item_count_to_;
 public:
-	TestSuit2Scenario(int operation_count, int iteration_count, double insert_ratio);
+	TestSuit2Scenario(int operation_count, int iteration_count, double insert_ratio, double item_count_from = 10000, double item_count_to = 2000000);
 	int operation_count(), iteration_count();
-	double insert_ratio();
+	double insert_ratio(), item_count_from(), item_count_to();
+};
+
+class TestSuit3Scenario : public Scenario
+{
+private:
+	int thread_count_, operation_count_, p_push_, item_count_, sample_interval_;
+public:
+	TestSuit3Scenario(int thread_count, int operation_count, int p_push, int item_count, int sample_interval = 8);
+	int thread_count(), operation_count(), p_push(), item_count(), sample_interval();
+};
+
+class TestSuit4Scenario : public Scenario
+{
+private:
+	int tick_count_, batch_size_, p_push_, pop_count_;
+	bool batched_;
+public:
+	TestSuit4Scenario(int tick_count, int batch_size, int p_push, int pop_count, bool batched);
+	int tick_count(), batch_size(), p_push(), pop_count();
+	bool batched();
+};
+
+class TestSuit5Scenario : public Scenario
+{
+private:
+	int round_count_, heap_count_, heap_size_;
+public:
+	TestSuit5Scenario(int round_count, int heap_count, int heap_size);
+	int round_count(), heap_count(), heap_size();
+};
+
+class TestSuit6Scenario : public Scenario
+{
+private:
+	int worker_count_, task_count_, task_work_, p_reprioritize_;
+public:
+	TestSuit6Scenario(int worker_count, int task_count, int task_work, int p_reprioritize);
+	int worker_count(), task_count(), task_work(), p_reprioritize();
+};
+
+class TestSuit7Scenario : public Scenario
+{
+private:
+	int timer_count_, tick_count_, p_cancel_, p_reschedule_, coroutine_count_;
+public:
+	TestSuit7Scenario(int timer_count, int tick_count, int p_cancel, int p_reschedule, int coroutine_count);
+	int timer_count(), tick_count(), p_cancel(), p_reschedule(), coroutine_count();
+};
+
+class TestSuit8Scenario : public Scenario
+{
+private:
+	int capacity_, count_, p_push_, p_pop_, p_pop_max_, p_change_;
+public:
+	TestSuit8Scenario(int capacity, int count, int p_push, int p_pop, int p_pop_max, int p_change);
+	int capacity(), count(), p_push(), p_pop(), p_pop_max(), p_change();
+};
+
+class TestSuit9Scenario : public Scenario
+{
+private:
+	int item_count_, step_count_, pop_count_;
+public:
+	TestSuit9Scenario(int item_count, int step_count, int pop_count);
+	int item_count(), step_count(), pop_count();
 };
 
 class TS1ScenarioA : public TestSuit1Scenario
@@ -60,6 +125,12 @@ public:
 	TS1ScenarioE();
 };
 
+class TS1ScenarioF : public TestSuit1Scenario
+{
+public:
+	TS1ScenarioF();
+};
+
 class TS2ScenarioA : public TestSuit2Scenario
 {
 public:
@@ -70,4 +141,106 @@ class TS2ScenarioB : public TestSuit2Scenario
 {
 public:
 	TS2ScenarioB();
-};
\ No newline at end of file
+};
+
+class TS2ScenarioC : public TestSuit2Scenario
+{
+public:
+	TS2ScenarioC();
+};
+
+class TS2ScenarioD : public TestSuit2Scenario
+{
+public:
+	TS2ScenarioD();
+};
+
+class TS3ScenarioA : public TestSuit3Scenario
+{
+public:
+	TS3ScenarioA();
+};
+
+class TS3ScenarioB : public TestSuit3Scenario
+{
+public:
+	TS3ScenarioB();
+};
+
+class TS3ScenarioC : public TestSuit3Scenario
+{
+public:
+	TS3ScenarioC();
+};
+
+class TS4ScenarioA : public TestSuit4Scenario
+{
+public:
+	TS4ScenarioA();
+};
+
+class TS4ScenarioB : public TestSuit4Scenario
+{
+public:
+	TS4ScenarioB();
+};
+
+class TS5ScenarioA : public TestSuit5Scenario
+{
+public:
+	TS5ScenarioA();
+};
+
+class TS5ScenarioB : public TestSuit5Scenario
+{
+public:
+	TS5ScenarioB();
+};
+
+class TS6ScenarioA : public TestSuit6Scenario
+{
+public:
+	TS6ScenarioA();
+};
+
+class TS6ScenarioB : public TestSuit6Scenario
+{
+public:
+	TS6ScenarioB();
+};
+
+class TS7ScenarioA : public TestSuit7Scenario
+{
+public:
+	TS7ScenarioA();
+};
+
+class TS7ScenarioB : public TestSuit7Scenario
+{
+public:
+	TS7ScenarioB();
+};
+
+class TS8ScenarioA : public TestSuit8Scenario
+{
+public:
+	TS8ScenarioA();
+};
+
+class TS8ScenarioB : public TestSuit8Scenario
+{
+public:
+	TS8ScenarioB();
+};
+
+class TS9ScenarioA : public TestSuit9Scenario
+{
+public:
+	TS9ScenarioA();
+};
+
+class TS9ScenarioB : public TestSuit9Scenario
+{
+public:
+	TS9ScenarioB();
+};
@@ -0,0 +1,463 @@
+#pragma once
+#include "PairingHeap.h"
+#include <algorithm>
+#include <climits>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <vector>
+
+/// <summary>
+/// asova naplnovan v slube asovaov
+/// </summary>
+class TimerServiceEntry
+{
+private:
+	/// <summary>
+	/// Prvok asovaa v prioritnom fronte, nullptr ak asova nie je aktvny
+	/// </summary>
+	PriorityQueueItem<long long, int>* node_;
+	/// <summary>
+	/// Funkcia vykonan po uplynut asovaa
+	/// </summary>
+	std::function<void()> callback_;
+	/// <summary>
+	/// Genercia asovaa, zvi sa pri kadom uvonen, aby identifiktor predchdzajceho asovaa nezasiahol nov
+	/// </summary>
+	int generation_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	TimerServiceEntry();
+	/// <summary>
+	/// Getter atribtu node_
+	/// </summary>
+	/// <returns>Prvok asovaa v prioritnom fronte</returns>
+	PriorityQueueItem<long long, int>*& node();
+	/// <summary>
+	/// Getter atribtu callback_
+	/// </summary>
+	/// <returns>Funkcia vykonan po uplynut asovaa</returns>
+	std::function<void()>& callback();
+	/// <summary>
+	/// Getter atribtu generation_
+	/// </summary>
+	/// <returns>Genercia asovaa</returns>
+	int& generation();
+};
+
+template <template <typename, typename> class Heap>
+class TimerService;
+
+/// <summary>
+/// Objekt, na ktor korutina ak cez co_await, km neuplynie termn
+/// </summary>
+/// <typeparam name="Heap">Prioritn front sluby asovaov</typeparam>
+template <template <typename, typename> class Heap>
+class TimerAwaiter
+{
+private:
+	/// <summary>
+	/// Sluba asovaov
+	/// </summary>
+	TimerService<Heap>* service_;
+	/// <summary>
+	/// Termn prebudenia korutiny
+	/// </summary>
+	long long deadline_;
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="service">Sluba asovaov</param>
+	/// <param name="deadline">Termn prebudenia korutiny</param>
+	TimerAwaiter(TimerService<Heap>* service, const long long deadline);
+	/// <summary>
+	/// Korutina sa neusp, ak termn u uplynul
+	/// </summary>
+	/// <returns>True, ak termn u uplynul</returns>
+	bool await_ready() const;
+	/// <summary>
+	/// Naplnuje asova, ktor korutinu prebud
+	/// </summary>
+	/// <param name="handle">Uspan korutina</param>
+	void await_suspend(std::coroutine_handle<> handle);
+	/// <summary>
+	/// Nevracia iadnu hodnotu
+	/// </summary>
+	void await_resume() const;
+};
+
+/// <summary>
+/// Korutina, ktor sa spust hne pri zavolan a po skonen sama uvon svoj rmec
+/// </summary>
+class TimerCoroutine
+{
+public:
+	/// <summary>
+	/// Sub korutiny
+	/// </summary>
+	class promise_type
+	{
+	public:
+		/// <summary>
+		/// Vrti objekt korutiny
+		/// </summary>
+		/// <returns>Objekt korutiny</returns>
+		TimerCoroutine get_return_object();
+		/// <summary>
+		/// Korutina sa na zaiatku neusp
+		/// </summary>
+		/// <returns>Objekt, ktor korutinu neusp</returns>
+		std::suspend_never initial_suspend();
+		/// <summary>
+		/// Korutina sa na konci neusp, rmec sa uvon
+		/// </summary>
+		/// <returns>Objekt, ktor korutinu neusp</returns>
+		std::suspend_never final_suspend() noexcept;
+		/// <summary>
+		/// Korutina nevracia iadnu hodnotu
+		/// </summary>
+		void return_void();
+		/// <summary>
+		/// Neoetren vnimka v korutine ukon program
+		/// </summary>
+		void unhandled_exception();
+	};
+};
+
+/// <summary>
+/// Sluba asovaov, ktor dr termny v prioritnom fronte
+/// Termny sa zaokrhuj nahor na cel tiky, asovae uplynut do toho istho tiku sa vyber z frontu naraz a a potom sa vykonaj,
+/// zruenie a presunutie asovaa je zmena priority jeho prvku, sluba nie je bezpen pre sben prstup z viacerch vlkien
+/// </summary>
+/// <typeparam name="Heap">Prioritn front termnov</typeparam>
+template <template <typename, typename> class Heap = PairingHeapTwoPass>
+class TimerService
+{
+private:
+	/// <summary>
+	/// Dka tiku
+	/// </summary>
+	long long tick_length_;
+	/// <summary>
+	/// Aktulny as
+	/// </summary>
+	long long now_;
+	/// <summary>
+	/// Prioritn front asovaov, priorita je tik uplynutia, dta s identifiktor asovaa
+	/// </summary>
+	Heap<long long, int>* heap_;
+	/// <summary>
+	/// asovae poda identifiktora
+	/// </summary>
+	std::vector<TimerServiceEntry>* timers_;
+	/// <summary>
+	/// Indexy uvonench asovaov, ktor mu by znovu pouit
+	/// </summary>
+	std::vector<int>* free_indices_;
+	/// <summary>
+	/// Funkcie asovaov uplynutch v aktulnom tiku
+	/// </summary>
+	std::vector<std::function<void()>>* expired_;
+	/// <summary>
+	/// Vrti tik, v ktorom uplynie termn
+	/// </summary>
+	/// <param name="deadline">Termn</param>
+	/// <returns>Tik uplynutia</returns>
+	long long tick_of(const long long deadline) const;
+	/// <summary>
+	/// Vrti identifiktor asovaa, vyie bity obsahuj generciu a niie index
+	/// </summary>
+	/// <param name="index">Index asovaa</param>
+	/// <returns>Identifiktor asovaa</returns>
+	long long handle_of(const int index);
+	/// <summary>
+	/// Vrti index aktvneho asovaa s identifiktorom handle
+	/// </summary>
+	/// <param name="handle">Identifiktor asovaa</param>
+	/// <returns>Index asovaa, -1 ak asova u uplynul, bol zruen alebo jeho index patr noviemu asovau</returns>
+	int index_of(const long long handle);
+	/// <summary>
+	/// Uvon index asovaa a zvi jeho generciu
+	/// </summary>
+	/// <param name="index">Index asovaa</param>
+	void release(const int index);
+public:
+	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="tick_length">Dka tiku, asovae uplynut v tom istom tiku sa vykonaj spolu</param>
+	TimerService(const long long tick_length = 1);
+	/// <summary>
+	/// Kontruktor pre prioritn fronty, ktor nemaj implicitn kontruktor
+	/// </summary>
+	/// <param name="tick_length">Dka tiku, asovae uplynut v tom istom tiku sa vykonaj spolu</param>
+	/// <param name="heap">Przdny prioritn front, ktorho vlastnctvo preber</param>
+	TimerService(const long long tick_length, Heap<long long, int>* heap);
+	/// <summary>
+	/// Detruktor, korutiny akajce na neuplynut asovae sa u neprebudia
+	/// </summary>
+	~TimerService();
+	/// <summary>
+	/// Getter atribtu now_
+	/// </summary>
+	/// <returns>Aktulny as</returns>
+	long long now() const;
+	/// <summary>
+	/// Vrti poet aktvnych asovaov
+	/// </summary>
+	/// <returns>Poet aktvnych asovaov</returns>
+	size_t size() const;
+	/// <summary>
+	/// Naplnuje asova
+	/// </summary>
+	/// <param name="deadline">Termn uplynutia</param>
+	/// <param name="callback">Funkcia vykonan po uplynut</param>
+	/// <returns>Identifiktor asovaa, platn do jeho uplynutia alebo zruenia, potom ho sluba odmietne</returns>
+	long long schedule(const long long deadline, const std::function<void()>& callback);
+	/// <summary>
+	/// Zru asova
+	/// </summary>
+	/// <param name="handle">Identifiktor asovaa</param>
+	/// <returns>True, ak bol asova aktvny</returns>
+	bool cancel(const long long handle);
+	/// <summary>
+	/// Zmen termn asovaa
+	/// </summary>
+	/// <param name="handle">Identifiktor asovaa</param>
+	/// <param name="deadline">Nov termn uplynutia</param>
+	/// <returns>True, ak bol asova aktvny</returns>
+	bool reschedule(const long long handle, const long long deadline);
+	/// <summary>
+	/// Posunie as a vykon vetky asovae, ktorch tik uplynul, nesmie by volan z funkcie asovaa
+	/// </summary>
+	/// <param name="now">Nov as, as sa nikdy nevracia sp</param>
+	/// <returns>Poet vykonanch asovaov</returns>
+	size_t advance(const long long now);
+	/// <summary>
+	/// Vrti objekt, ktorm korutina cez co_await pok do uplynutia termnu
+	/// </summary>
+	/// <param name="deadline">Termn prebudenia korutiny</param>
+	/// <returns>Objekt pre co_await</returns>
+	TimerAwaiter<Heap> sleep_until(const long long deadline);
+};
+
+inline TimerServiceEntry::TimerServiceEntry() :
+	node_(nullptr), callback_(nullptr), generation_(0)
+{
+}
+
+inline PriorityQueueItem<long long, int>*& TimerServiceEntry::node()
+{
+	return this->node_;
+}
+
+inline std::function<void()>& TimerServiceEntry::callback()
+{
+	return this->callback_;
+}
+
+inline int& TimerServiceEntry::generation()
+{
+	return this->generation_;
+}
+
+template<template <typename, typename> class Heap>
+inline TimerAwaiter<Heap>::TimerAwaiter(TimerService<Heap>* service, const long long deadline) :
+	service_(service), deadline_(deadline)
+{
+}
+
+template<template <typename, typename> class Heap>
+inline bool TimerAwaiter<Heap>::await_ready() const
+{
+	return this->deadline_ <= this->service_->now();
+}
+
+template<template <typename, typename> class Heap>
+inline void TimerAwaiter<Heap>::await_suspend(std::coroutine_handle<> handle)
+{
+	this->service_->schedule(this->deadline_, [handle]()
+	{
+		handle.resume();
+	});
+}
+
+template<template <typename, typename> class Heap>
+inline void TimerAwaiter<Heap>::await_resume() const
+{
+}
+
+inline TimerCoroutine TimerCoroutine::promise_type::get_return_object()
+{
+	return TimerCoroutine();
+}
+
+inline std::suspend_never TimerCoroutine::promise_type::initial_suspend()
+{
+	return std::suspend_never();
+}
+
+inline std::suspend_never TimerCoroutine::promise_type::final_suspend() noexcept
+{
+	return std::suspend_never();
+}
+
+inline void TimerCoroutine::promise_type::return_void()
+{
+}
+
+inline void TimerCoroutine::promise_type::unhandled_exception()
+{
+	std::terminate();
+}
+
+template<template <typename, typename> class Heap>
+inline TimerService<Heap>::TimerService(const long long tick_length) :
+	TimerService(tick_length, new Heap<long long, int>())
+{
+}
+
+template<template <typename, typename> class Heap>
+inline TimerService<Heap>::TimerService(const long long tick_length, Heap<long long, int>* heap) :
+	tick_length_(std::max(tick_length, 1LL)),
+	now_(0),
+	heap_(heap),
+	timers_(new std::vector<TimerServiceEntry>()),
+	free_indices_(new std::vector<int>()),
+	expired_(new std::vector<std::function<void()>>())
+{
+}
+
+template<template <typename, typename> class Heap>
+inline TimerService<Heap>::~TimerService()
+{
+	delete this->heap_;
+	delete this->timers_;
+	delete this->free_indices_;
+	delete this->expired_;
+	this->heap_ = nullptr;
+	this->timers_ = nullptr;
+	this->free_indices_ = nullptr;
+	this->expired_ = nullptr;
+}
+
+template<template <typename, typename> class Heap>
+inline long long TimerService<Heap>::now() const
+{
+	return this->now_;
+}
+
+template<template <typename, typename> class Heap>
+inline size_t TimerService<Heap>::size() const
+{
+	return this->heap_->size();
+}
+
+template<template <typename, typename> class Heap>
+inline long long TimerService<Heap>::schedule(const long long deadline, const std::function<void()>& callback)
+{
+	int index;
+	if (this->free_indices_->empty())
+	{
+		index = (int)this->timers_->size();
+		this->timers_->emplace_back();
+	}
+	else
+	{
+		index = this->free_indices_->back();
+		this->free_indices_->pop_back();
+	}
+	TimerServiceEntry& timer = (*this->timers_)[index];
+	timer.callback() = callback;
+	this->heap_->push(index, this->tick_of(deadline), index, timer.node());
+	return this->handle_of(index);
+}
+
+template<template <typename, typename> class Heap>
+inline bool TimerService<Heap>::cancel(const long long handle)
+{
+	int index = this->index_of(handle);
+	if (index < 0)
+	{
+		return false;
+	}
+	this->heap_->erase((*this->timers_)[index].node());
+	(*this->timers_)[index].callback() = nullptr;
+	this->release(index);
+	return true;
+}
+
+template<template <typename, typename> class Heap>
+inline bool TimerService<Heap>::reschedule(const long long handle, const long long deadline)
+{
+	int index = this->index_of(handle);
+	if (index < 0)
+	{
+		return false;
+	}
+	this->heap_->change_priority((*this->timers_)[index].node(), this->tick_of(deadline));
+	return true;
+}
+
+template<template <typename, typename> class Heap>
+inline size_t TimerService<Heap>::advance(const long long now)
+{
+	this->now_ = std::max(this->now_, now);
+	long long tick = this->now_ / this->tick_length_;
+	while (this->heap_->size() > 0 && this->heap_->find_min_item()->priority() <= tick)
+	{
+		int identifier;
+		int index = this->heap_->pop(identifier);
+		this->expired_->push_back(std::move((*this->timers_)[index].callback()));
+		(*this->timers_)[index].callback() = nullptr;
+		this->release(index);
+	}
+	size_t expired_count = this->expired_->size();
+	for (std::function<void()>& callback : *this->expired_)
+	{
+		callback();
+	}
+	this->expired_->clear();
+	return expired_count;
+}
+
+template<template <typename, typename> class Heap>
+inline TimerAwaiter<Heap> TimerService<Heap>::sleep_until(const long long deadline)
+{
+	return TimerAwaiter<Heap>(this, deadline);
+}
+
+template<template <typename, typename> class Heap>
+inline long long TimerService<Heap>::tick_of(const long long deadline) const
+{
+	return deadline <= 0 ? deadline / this->tick_length_ : (deadline - 1) / this->tick_length_ + 1;
+}
+
+template<template <typename, typename> class Heap>
+inline long long TimerService<Heap>::handle_of(const int index)
+{
+	return (long long)(*this->timers_)[index].generation() << 32 | index;
+}
+
+template<template <typename, typename> class Heap>
+inline int TimerService<Heap>::index_of(const long long handle)
+{
+	int index = (int)(handle & UINT_MAX);
+	if (handle < 0 || index < 0 || index >= (int)this->timers_->size() || !(*this->timers_)[index].node() || (handle >> 32) != (*this->timers_)[index].generation())
+	{
+		return -1;
+	}
+	return index;
+}
+
+template<template <typename, typename> class Heap>
+inline void TimerService<Heap>::release(const int index)
+{
+	TimerServiceEntry& timer = (*this->timers_)[index];
+	timer.node() = nullptr;
+	timer.generation() = timer.generation() == INT_MAX ? 0 : timer.generation() + 1;
+	this->free_indices_->push_back(index);
+}
@@ -2,12 +2,15 @@
 #include "BinaryHeap.h"
 #include "BinomialHeap.h"
 #include "FibonacciHeap.h"
+#include "MinMaxHeap.h"
 #include "PairingHeap.h"
 #include "RankPairingHeap.h"
+#include "ItemPool.h"
 #include <iostream>
 #include <fstream>
 #include <chrono>
 #include <unordered_map>
+#include <initializer_list>
 #include <time.h>
 #include <sys/timeb.h>
 
@@ -25,20 +28,49 @@ template <typename Priority, typename Data>
 class PriorityQueueWrapper
 {
 private:
+	/// <summary>
+	/// Zsobnk uzlov tabuliek obaujcej triedy
+	/// </summary>
+	ItemPool* map_pool_;
 	/// <summary>
 	/// Tabuka mapujca identifiktory k prvkom
 	/// </summary>
-	std::unordered_map<int, PriorityQueueItem<Priority, Data>*>* identifier_map_;
+	PooledMap<int, PriorityQueueItem<Priority, Data>*>* identifier_map_;
 	/// <summary>
 	/// Prioritn front
 	/// </summary>
 	PriorityQueue<Priority, Data>* priority_queue_;
+	/// <summary>
+	/// Prznak, i sa zmeny priority zluuj a aplikuj a pred vberom
+	/// </summary>
+	bool coalescing_;
+	/// <summary>
+	/// akajce zmeny priority, pre kad prvok najviac jedna s poslednou prioritou
+	/// </summary>
+	std::vector<PriorityQueueOperation<Priority, Data>>* pending_changes_;
+	/// <summary>
+	/// Tabuka mapujca identifiktory k indexom akajcich zmien priority
+	/// </summary>
+	PooledMap<int, size_t>* pending_indices_;
+	/// <summary>
+	/// Poet poadovanch zmien priority
+	/// </summary>
+	size_t change_count_;
+	/// <summary>
+	/// Poet zmien priority aplikovanch na prioritn front
+	/// </summary>
+	size_t restructuring_count_;
+	/// <summary>
+	/// Aplikuje akajce zmeny priority jednou dvkou
+	/// </summary>
+	void apply_pending_changes();
 public:
 	/// <summary>
 	/// Kontruktor
 	/// </summary>
 	/// <param name="priority_queue">Prioritn front</param>
-	PriorityQueueWrapper(PriorityQueue<Priority, Data>* priority_queue);
+	/// <param name="coalescing">True, ak sa maj opakovan zmeny priority prvku zli a aplikova a pred vberom</param>
+	PriorityQueueWrapper(PriorityQueue<Priority, Data>* priority_queue, const bool coalescing = false);
 	/// <summary>
 	/// Detruktor
 	/// </summary>
@@ -60,11 +92,42 @@ public:
 	/// <returns>Idenifiktor odstranenho prvku</returns>
 	int pop();
 	/// <summary>
+	/// Vyberie prvok identifier, ak m najviu prioritu, pri rovnosti priort ho vyberie namiesto prvku, ktor by vybral prioritn front,
+	/// aby sa prioritn fronty so zoznamom nerozili pri rznom porad prvkov s rovnakou prioritou
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku vybranho z prvho prioritnho frontu zoznamu</param>
+	void pop_matching(const int identifier);
+	/// <summary>
+	/// Opercia obaujca operciu vr minimum
+	/// </summary>
+	/// <returns>Identifiktor prvku s najvou prioritou</returns>
+	int find_min();
+	/// <summary>
 	/// Opercia obaujca operciu zme prioritu
 	/// </summary>
 	/// <param name="identifier">Identifiktor prvku</param>
 	/// <param name="priority">Nov priorita prvku</param>
 	void change_priority(const int identifier, const Priority& priority);
+	/// <summary>
+	/// Opercia obaujca operciu odstr prvok
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	void erase(const int identifier);
+	/// <summary>
+	/// Aplikuje dvku operci, najprv vetky vloenia a potom vetky zmeny priority
+	/// </summary>
+	/// <param name="operations">Dvka operci</param>
+	void apply_batch(const std::vector<PriorityQueueOperation<Priority, Data>>& operations);
+	/// <summary>
+	/// Vrti poet poadovanch zmien priority
+	/// </summary>
+	/// <returns>Poet zmien priority</returns>
+	size_t change_count() const;
+	/// <summary>
+	/// Vrti poet zmien priority, ktor sa vaka zluovaniu nemuseli aplikova na prioritn front
+	/// </summary>
+	/// <returns>Poet uetrench preusporiadan</returns>
+	size_t saved_restructuring_count() const;
 };
 
 /// <summary>
@@ -89,6 +152,12 @@ public:
 	/// </summary>
 	PriorityQueueList();
 	/// <summary>
+	/// Kontruktor
+	/// </summary>
+	/// <param name="priority_queues">Prioritn fronty, ktor sa maj testova</param>
+	/// <param name="coalescing">True, ak sa maj zmeny priority zluova</param>
+	PriorityQueueList(std::initializer_list<PriorityQueue<Priority, Data>*> priority_queues, const bool coalescing = false);
+	/// <summary>
 	/// Detruktor
 	/// </summary>
 	~PriorityQueueList();
@@ -123,12 +192,38 @@ public:
 	/// <param name="identifier">Identifiktor prvku</param>
 	/// <param name="priority">Nov priorita</param>
 	void change_priority(const int identifier, const Priority& priority);
+	/// <summary>
+	/// Odstrni prvok s identifiktorom identifier zo vetkch prioritnch frontov
+	/// </summary>
+	/// <param name="identifier">Identifiktor prvku</param>
+	void erase(const int identifier);
+	/// <summary>
+	/// Aplikuje dvku operci na vetky prioritn fronty
+	/// </summary>
+	/// <param name="operations">Dvka operci</param>
+	void apply_batch(const std::vector<PriorityQueueOperation<Priority, Data>>& operations);
+	/// <summary>
+	/// Vrti set poadovanch zmien priority vetkch prioritnch frontov
+	/// </summary>
+	/// <returns>Poet zmien priority</returns>
+	size_t change_count();
+	/// <summary>
+	/// Vrti set uetrench preusporiadan vetkch prioritnch frontov
+	/// </summary>
+	/// <returns>Poet uetrench preusporiadan</returns>
+	size_t saved_restructuring_count();
 };
 
 template<typename Priority, typename Data>
-inline PriorityQueueWrapper<Priority, Data>::PriorityQueueWrapper(PriorityQueue<Priority, Data>* priority_queue) :
-	identifier_map_(new std::unordered_map<int, PriorityQueueItem<Priority, Data>*>()),
-	priority_queue_(priority_queue)
+inline PriorityQueueWrapper<Priority, Data>::PriorityQueueWrapper(PriorityQueue<Priority, Data>* priority_queue, const bool coalescing) :
+	map_pool_(new ItemPool()),
+	identifier_map_(new PooledMap<int, PriorityQueueItem<Priority, Data>*>(0, std::hash<int>(), std::equal_to<int>(), PoolAllocator<std::pair<const int, PriorityQueueItem<Priority, Data>*>>(map_pool_))),
+	priority_queue_(priority_queue),
+	coalescing_(coalescing),
+	pending_changes_(new std::vector<PriorityQueueOperation<Priority, Data>>()),
+	pending_indices_(new PooledMap<int, size_t>(0, std::hash<int>(), std::equal_to<int>(), PoolAllocator<std::pair<const int, size_t>>(map_pool_))),
+	change_count_(0),
+	restructuring_count_(0)
 {
 }
 
@@ -137,8 +232,14 @@ inline PriorityQueueWrapper<Priority, Data>::~PriorityQueueWrapper()
 {
 	delete this->priority_queue_;
 	delete this->identifier_map_;
+	delete this->pending_changes_;
+	delete this->pending_indices_;
+	delete this->map_pool_;
 	this->priority_queue_ = nullptr;
 	this->identifier_map_ = nullptr;
+	this->pending_changes_ = nullptr;
+	this->pending_indices_ = nullptr;
+	this->map_pool_ = nullptr;
 }
 
 template<typename Priority, typename Data>
@@ -146,6 +247,8 @@ inline void PriorityQueueWrapper<Priority, Data>::reset()
 {
 	this->priority_queue_->clear();
 	this->identifier_map_->clear();
+	this->pending_changes_->clear();
+	this->pending_indices_->clear();
 }
 
 template<typename Priority, typename Data>
@@ -160,16 +263,132 @@ template<typename Priority, typename Data>
 inline int PriorityQueueWrapper<Priority, Data>::pop()
 {
 	int identifier;
+	this->apply_pending_changes();
 	this->priority_queue_->pop(identifier);
 	this->identifier_map_->erase(identifier);
 	return identifier;
 }
 
+template<typename Priority, typename Data>
+inline void PriorityQueueWrapper<Priority, Data>::pop_matching(const int identifier)
+{
+	this->apply_pending_changes();
+	PriorityQueueItem<Priority, Data>* minimal_item = this->priority_queue_->find_min_item();
+	if (minimal_item->identifier() == identifier)
+	{
+		this->pop();
+		return;
+	}
+	if ((*this->identifier_map_)[identifier]->priority() != minimal_item->priority())
+	{
+		throw new std::logic_error("PriorityQueueWrapper<Priority, Data>::pop_matching(): Prioritne fronty vybrali prvky s roznou prioritou");
+	}
+	this->erase(identifier);
+}
+
+template<typename Priority, typename Data>
+inline int PriorityQueueWrapper<Priority, Data>::find_min()
+{
+	this->apply_pending_changes();
+	return this->priority_queue_->find_min_item()->identifier();
+}
+
 template<typename Priority, typename Data>
 inline void PriorityQueueWrapper<Priority, Data>::change_priority(const int identifier, const Priority& priority)
 {
 	PriorityQueueItem<Priority, Data>* priority_queue_item = (*this->identifier_map_)[identifier];
-	this->priority_queue_->change_priority(priority_queue_item, priority);
+	this->change_count_++;
+	if (!this->coalescing_)
+	{
+		this->priority_queue_->change_priority(priority_queue_item, priority);
+		this->restructuring_count_++;
+		return;
+	}
+	typename PooledMap<int, size_t>::iterator pending = this->pending_indices_->find(identifier);
+	if (pending != this->pending_indices_->end())
+	{
+		(*this->pending_changes_)[pending->second].priority() = priority;
+	}
+	else
+	{
+		(*this->pending_indices_)[identifier] = this->pending_changes_->size();
+		this->pending_changes_->push_back(PriorityQueueOperation<Priority, Data>(OperationType::CHANGE_PRIORITY, identifier, priority));
+		this->pending_changes_->back().node() = priority_queue_item;
+	}
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueueWrapper<Priority, Data>::erase(const int identifier)
+{
+	PriorityQueueItem<Priority, Data>* priority_queue_item = (*this->identifier_map_)[identifier];
+	typename PooledMap<int, size_t>::iterator pending = this->pending_indices_->find(identifier);
+	if (pending != this->pending_indices_->end())
+	{
+		size_t index = pending->second;
+		this->pending_indices_->erase(pending);
+		if (index != this->pending_changes_->size() - 1)
+		{
+			(*this->pending_changes_)[index] = this->pending_changes_->back();
+			(*this->pending_indices_)[(*this->pending_changes_)[index].identifier()] = index;
+		}
+		this->pending_changes_->pop_back();
+	}
+	this->priority_queue_->erase(priority_queue_item);
+	this->identifier_map_->erase(identifier);
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueueWrapper<Priority, Data>::apply_batch(const std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	std::vector<PriorityQueueOperation<Priority, Data>> pushes, changes;
+	this->apply_pending_changes();
+	for (const PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		if (operation.type() == OperationType::PUSH)
+		{
+			pushes.push_back(operation);
+		}
+		else
+		{
+			changes.push_back(operation);
+		}
+	}
+	this->priority_queue_->push_batch(pushes);
+	for (PriorityQueueOperation<Priority, Data>& operation : pushes)
+	{
+		(*this->identifier_map_)[operation.identifier()] = operation.node();
+	}
+	for (PriorityQueueOperation<Priority, Data>& operation : changes)
+	{
+		operation.node() = (*this->identifier_map_)[operation.identifier()];
+	}
+	this->priority_queue_->change_priority_batch(changes);
+	this->change_count_ += changes.size();
+	this->restructuring_count_ += changes.size();
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueueWrapper<Priority, Data>::change_count() const
+{
+	return this->change_count_;
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueueWrapper<Priority, Data>::saved_restructuring_count() const
+{
+	return this->change_count_ - this->restructuring_count_ - this->pending_changes_->size();
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueueWrapper<Priority, Data>::apply_pending_changes()
+{
+	if (!this->pending_changes_->empty())
+	{
+		this->priority_queue_->change_priority_batch(*this->pending_changes_);
+		this->restructuring_count_ += this->pending_changes_->size();
+		this->pending_changes_->clear();
+		this->pending_indices_->clear();
+	}
 }
 
 template<typename Priority, typename Data>
@@ -186,6 +405,17 @@ inline PriorityQueueList<Priority, Data>::PriorityQueueList() :
 	priority_queue_list_->push_back(new PriorityQueueWrapper<Priority, Data>(new BinomialHeapMultiPass<Priority, Data>()));
 }
 
+template<typename Priority, typename Data>
+inline PriorityQueueList<Priority, Data>::PriorityQueueList(std::initializer_list<PriorityQueue<Priority, Data>*> priority_queues, const bool coalescing) :
+	priority_queue_list_(new std::list<PriorityQueueWrapper<Priority, Data>*>()),
+	identifier_set_(new RandomizedSet())
+{
+	for (PriorityQueue<Priority, Data>* priority_queue : priority_queues)
+	{
+		priority_queue_list_->push_back(new PriorityQueueWrapper<Priority, Data>(priority_queue, coalescing));
+	}
+}
+
 template<typename Priority, typename Data>
 inline PriorityQueueList<Priority, Data>::~PriorityQueueList()
 {
@@ -234,10 +464,10 @@ inline void PriorityQueueList<Priority, Data>::push(const int identifier, const
 template<typename Priority, typename Data>
 inline void PriorityQueueList<Priority, Data>::pop()
 {
-	int identifier;
-	for (PriorityQueueWrapper<Priority, Data>* item : *this->priority_queue_list_)
+	int identifier = this->priority_queue_list_->front()->pop();
+	for (typename std::list<PriorityQueueWrapper<Priority, Data>*>::iterator item = std::next(this->priority_queue_list_->begin()); item != this->priority_queue_list_->end(); item++)
 	{
-		identifier = item->pop();
+		(*item)->pop_matching(identifier);
 	}
 	this->identifier_set_->remove(identifier);
 }
@@ -251,15 +481,67 @@ inline void PriorityQueueList<Priority, Data>::change_priority(const int identif
 	}
 }
 
+template<typename Priority, typename Data>
+inline void PriorityQueueList<Priority, Data>::erase(const int identifier)
+{
+	for (PriorityQueueWrapper<Priority, Data>* item : *this->priority_queue_list_)
+	{
+		item->erase(identifier);
+	}
+	this->identifier_set_->remove(identifier);
+}
+
+template<typename Priority, typename Data>
+inline void PriorityQueueList<Priority, Data>::apply_batch(const std::vector<PriorityQueueOperation<Priority, Data>>& operations)
+{
+	for (PriorityQueueWrapper<Priority, Data>* item : *this->priority_queue_list_)
+	{
+		item->apply_batch(operations);
+	}
+	for (const PriorityQueueOperation<Priority, Data>& operation : operations)
+	{
+		if (operation.type() == OperationType::PUSH)
+		{
+			this->identifier_set_->insert(operation.identifier());
+		}
+	}
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueueList<Priority, Data>::change_count()
+{
+	size_t count = 0;
+	for (PriorityQueueWrapper<Priority, Data>* item : *this->priority_queue_list_)
+	{
+		count += item->change_count();
+	}
+	return count;
+}
+
+template<typename Priority, typename Data>
+inline size_t PriorityQueueList<Priority, Data>::saved_restructuring_count()
+{
+	size_t count = 0;
+	for (PriorityQueueWrapper<Priority, Data>* item : *this->priority_queue_list_)
+	{
+		count += item->saved_restructuring_count();
+	}
+	return count;
+}
+
 /// <summary>
 /// Tabuka s O(1) prstupom k nhodnmu prvku
 /// Variacia https://www.geeksforgeeks.org/design-a-data-structure-that-supports-insert-delete-getrandom-in-o1-with-duplicates/
 /// </summary>
 class RandomizedSet {
+	/// <summary>
+	/// Zsobnk uzlov tabuky
+	/// </summary>
+	ItemPool pool_;
 	/// <summary>
 	/// Tabuka mapujca identifiktory k indexom v implicitnom zozname
 	/// </summary>
-	std::unordered_map<int, int> map_;
+	PooledMap<int, int> map_;
 	/// <summary>
 	/// Implicitn zoznam identifiktorov
 	/// </summary>
@@ -268,7 +550,7 @@ public:
 	/// <summary>
 	/// Kontruktor
 	/// </summary>
-	RandomizedSet() {}
+	RandomizedSet() : map_(0, std::hash<int>(), std::equal_to<int>(), PoolAllocator<std::pair<const int, int>>(&pool_)) {}
 	/// <summary>
 	/// Vlo identifiktor do tabuky
 	/// </summary>
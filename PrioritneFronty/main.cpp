@@ -13,7 +13,89 @@ int main()
 	Tests::execute(list, TS1ScenarioC());
 	Tests::execute(list, TS1ScenarioD());
 	Tests::execute(list, TS1ScenarioE());
+	Tests::execute(list, TS1ScenarioF());
+	Tests::coalescing(TS1ScenarioD());
+	Tests::allocations(TS1ScenarioF());
+	Tests::compact_nodes(TS1ScenarioF());
 	Tests::execute(list, TS2ScenarioA());
 	Tests::execute(list, TS2ScenarioB());
+	Tests::execute(list, TS4ScenarioA());
+	Tests::execute(list, TS4ScenarioB());
+	PriorityQueueList<int, int> layout_list({ new BinaryHeap<int, int>(), new BinaryHeapBlocked<int, int>() });
+	Tests::execute(layout_list, TS2ScenarioC());
+	PriorityQueueList<int, int> simd_list({ new BinaryHeap<int, int>(), new SimdHeap<int, int>(), new SimdHeap<int, int>(SimdLevel::AVX2) });
+	Tests::execute(simd_list, TS2ScenarioC());
+	PriorityQueueList<int, int> bucket_list({ new BinaryHeap<int, int>(), new BucketQueueBounded<int, int>(0, RAND_MAX), new BucketQueueCalendar<int, int>() });
+	Tests::execute(bucket_list, TS1ScenarioD());
+	Tests::execute(bucket_list, TS1ScenarioF());
+	Tests::execute(bucket_list, TS2ScenarioB());
+	PriorityQueueList<int, int> prefetch_list({ new BinaryHeap<int, int>() });
+	Tests::execute(prefetch_list, TS2ScenarioD());
+	PriorityQueueList<int, int> double_ended_list({ new BinaryHeap<int, int>(), new MinMaxHeap<int, int>() });
+	Tests::execute(double_ended_list, TS1ScenarioD());
+	Tests::execute(double_ended_list, TS1ScenarioF());
+	Tests::execute(TS8ScenarioA());
+	Tests::execute(TS8ScenarioB());
+	for (RankRule rank_rule : { RankRule::TYPE_1, RankRule::TYPE_2 })
+	{
+		for (ConsolidationStrategy consolidation_strategy : { ConsolidationStrategy::ONE_PASS, ConsolidationStrategy::MULTI_PASS })
+		{
+			PriorityQueueList<int, int> rank_pairing_list({ new RankPairingHeap<int, int>(rank_rule, consolidation_strategy) });
+			Tests::execute(rank_pairing_list, TS1ScenarioD());
+		}
+	}
+	PriorityQueue<int, int>* (*heap_factories[])() = {
+		[]() -> PriorityQueue<int, int>* { return new BinaryHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new PairingHeapTwoPass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new BinomialHeapMultiPass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new FibonacciHeap<int, int>(); }
+	};
+	for (PriorityQueue<int, int>* (*create_heap)() : heap_factories)
+	{
+		Tests::execute(create_heap, TS5ScenarioA());
+		Tests::execute(create_heap, TS5ScenarioB());
+	}
+	PriorityQueue<int, int>* (*pop_n_factories[])() = {
+		[]() -> PriorityQueue<int, int>* { return new BinaryHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new BinomialHeapOnePass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new BinomialHeapMultiPass<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new FibonacciHeap<int, int>(); },
+		[]() -> PriorityQueue<int, int>* { return new RankPairingHeap<int, int>(); }
+	};
+	for (PriorityQueue<int, int>* (*create_heap)() : pop_n_factories)
+	{
+		Tests::execute(create_heap, TS9ScenarioA());
+		Tests::execute(create_heap, TS9ScenarioB());
+	}
+	Tests::published_minimum(TS3ScenarioA());
+	Tests::ingestion(TS3ScenarioA());
+	Tests::execute(TS6ScenarioA());
+	Tests::execute(TS6ScenarioB());
+	Tests::execute(TS7ScenarioA());
+	Tests::execute(TS7ScenarioB());
+	ConcurrentPriorityQueue<int, int>* concurrent_queues[] = {
+		new LockedPriorityQueue<int, int>(new PairingHeapTwoPass<int, int>()),
+		new FlatCombiningPriorityQueue<int, int, PairingHeapTwoPass>(TS3ScenarioA().thread_count()),
+		new LockedPriorityQueue<int, int>(new BinaryHeap<int, int>()),
+		new FlatCombiningPriorityQueue<int, int, BinaryHeap>(TS3ScenarioA().thread_count()),
+		new LockedPriorityQueue<int, int>(new BinomialHeapMultiPass<int, int>()),
+		new FlatCombiningPriorityQueue<int, int, BinomialHeapMultiPass>(TS3ScenarioA().thread_count()),
+		new LockedPriorityQueue<int, int>(new FibonacciHeap<int, int>()),
+		new FlatCombiningPriorityQueue<int, int, FibonacciHeap>(TS3ScenarioA().thread_count()),
+		new LockedPriorityQueue<int, int>(new RankPairingHeap<int, int>(RankRule::TYPE_1, ConsolidationStrategy::ONE_PASS)),
+		new FlatCombiningPriorityQueue<int, int, RankPairingHeap>(TS3ScenarioA().thread_count(), new RankPairingHeap<int, int>(RankRule::TYPE_1, ConsolidationStrategy::ONE_PASS)),
+		new SkipListPriorityQueue<int, int>(),
+		new MultiQueue<int, int, BinaryHeap>(TS3ScenarioA().thread_count(), 2),
+		new MultiQueue<int, int, BinaryHeap>(TS3ScenarioA().thread_count(), 4),
+		new MultiQueue<int, int, PairingHeapTwoPass>(TS3ScenarioA().thread_count(), 2)
+	};
+	for (ConcurrentPriorityQueue<int, int>* concurrent_queue : concurrent_queues)
+	{
+		Tests::execute(*concurrent_queue, TS3ScenarioA());
+		Tests::execute(*concurrent_queue, TS3ScenarioB());
+		Tests::execute(*concurrent_queue, TS3ScenarioC());
+		Tests::rank_error(*concurrent_queue, TS3ScenarioA());
+		delete concurrent_queue;
+	}
 	return 0;
 }
\ No newline at end of file